@@ -0,0 +1,233 @@
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include "GraphBase.h"
+#include "../structures/DynamicArray.h"
+#include "../structures/Dictionary.h"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+// Неизменяемый снимок графа в формате CSR (compressed sparse row).
+// Вершины перенумерованы плотными индексами 0..V-1 в порядке обхода исходного графа,
+// дуги вершины u лежат в targets/weights на отрезке [offsets[u], offsets[u + 1])
+// и отсортированы по индексу соседа. Ребро неориентированного графа хранится
+// двумя дугами (петля - одной). Обход соседей не выделяет память.
+// Индекс вершин - хеш-таблица, если для T есть std::hash, иначе AVL-дерево (нужен только operator<).
+template<typename T>
+class CsrGraph 
+{
+public:
+    // Соседи одной вершины: отрезок массивов targets и weights
+    class NeighborSpan 
+    {
+    private:
+        const int* targets;
+        const double* weights;
+        int count;
+
+    public:
+        NeighborSpan(const int* targets, const double* weights, int count) : targets(targets), weights(weights), count(count) {}
+
+        int GetCount() const { return count; }
+        int Target(int i) const { return targets[i]; }
+        double Weight(int i) const { return weights[i]; }
+
+        const int* begin() const { return targets; }
+        const int* end() const { return targets + count; }
+    };
+
+private:
+    bool directed;
+    int edgeCount;
+    DynamicArray<T> vertices;                    // индекс -> вершина
+    Dictionary<T, int, IndexStorage<T>> indices; // вершина -> индекс
+    DynamicArray<int> offsets;                   // V + 1 элементов
+    DynamicArray<int> targets;
+    DynamicArray<double> weights;
+
+    void checkIndex(int index) const 
+    {
+        if (index < 0 || index >= vertices.GetSize()) 
+        {
+            throw std::out_of_range("Vertex index out of range");
+        }
+    }
+
+    // Упорядочивает дуги вершины по индексу соседа. Графы на словарях уже отдают
+    // соседей по возрастанию, поэтому обычно хватает одной проверки
+    void sortRow(int u) 
+    {
+        int begin = offsets[u];
+        int end = targets.GetSize();
+        bool sorted = true;
+        for (int i = begin + 1; i < end && sorted; i++) 
+        {
+            sorted = targets[i - 1] <= targets[i];
+        }
+        if (sorted) return;
+
+        DynamicArray<std::pair<int, double>> row(end - begin);
+        for (int i = begin; i < end; i++) 
+        {
+            row[i - begin] = std::make_pair(targets[i], weights[i]);
+        }
+        std::sort(row.Data(), row.Data() + row.GetSize());
+        for (int i = begin; i < end; i++) 
+        {
+            targets[i] = row[i - begin].first;
+            weights[i] = row[i - begin].second;
+        }
+    }
+
+public:
+    CsrGraph() : directed(false), edgeCount(0), offsets(1) {}
+
+    explicit CsrGraph(const GraphBase<T>& graph) : directed(graph.IsDirected()), edgeCount(graph.GetEdgeCount()) 
+    {
+        int n = graph.GetVertexCount();
+        vertices.Reserve(n);
+        indices.Reserve(n);
+        graph.ForEachVertex([this](const T& vertex) 
+        {
+            indices.Add(vertex, vertices.GetSize());
+            vertices.PushBack(vertex);
+        });
+        n = vertices.GetSize();
+
+        int expectedArcs = directed ? edgeCount : 2 * edgeCount;
+        targets.Reserve(expectedArcs);
+        weights.Reserve(expectedArcs);
+        offsets = DynamicArray<int>(n + 1);
+
+        for (int u = 0; u < n; u++) 
+        {
+            offsets[u] = targets.GetSize();
+            graph.ForEachEdgeFrom(vertices[u], [this](const T& to, double weight) 
+            {
+                targets.PushBack(*indices.TryGet(to));
+                weights.PushBack(weight);
+            });
+            sortRow(u);
+        }
+        offsets[n] = targets.GetSize();
+    }
+
+    // Транспонированный снимок: дуга u -> v становится дугой v -> u, индексы вершин сохраняются.
+    // Строится подсчётом за O(V + E); строки получаются отсортированными, так как
+    // исходные вершины перебираются по возрастанию
+    CsrGraph Transpose() const 
+    {
+        int n = vertices.GetSize();
+        int arcs = targets.GetSize();
+        CsrGraph result;
+        result.directed = directed;
+        result.edgeCount = edgeCount;
+        result.vertices = vertices;
+        result.indices = indices;
+        result.offsets = DynamicArray<int>(n + 1);
+        result.targets = DynamicArray<int>(arcs);
+        result.weights = DynamicArray<double>(arcs);
+
+        for (int i = 0; i < arcs; i++) 
+        {
+            result.offsets[targets[i] + 1]++;
+        }
+        for (int v = 0; v < n; v++) 
+        {
+            result.offsets[v + 1] += result.offsets[v];
+        }
+
+        DynamicArray<int> position(n);
+        for (int v = 0; v < n; v++) 
+        {
+            position[v] = result.offsets[v];
+        }
+        for (int u = 0; u < n; u++) 
+        {
+            for (int i = offsets[u]; i < offsets[u + 1]; i++) 
+            {
+                int slot = position[targets[i]]++;
+                result.targets[slot] = u;
+                result.weights[slot] = weights[i];
+            }
+        }
+        return result;
+    }
+
+    // Копия снимка с теми же дугами и весами func(from, to, weight) (например, для перевзвешивания)
+    template <typename Func>
+    CsrGraph MapWeights(Func func) const 
+    {
+        CsrGraph result(*this);
+        for (int u = 0; u < vertices.GetSize(); u++) 
+        {
+            for (int i = offsets[u]; i < offsets[u + 1]; i++) 
+            {
+                result.weights[i] = func(u, targets[i], weights[i]);
+            }
+        }
+        return result;
+    }
+
+    int GetVertexCount() const { return vertices.GetSize(); }
+
+    // Число рёбер исходного графа
+    int GetEdgeCount() const { return edgeCount; }
+
+    // Число хранимых дуг (для неориентированного графа - почти вдвое больше рёбер)
+    int GetArcCount() const { return targets.GetSize(); }
+
+    bool IsDirected() const { return directed; }
+
+    const T& GetVertex(int index) const 
+    {
+        checkIndex(index);
+        return vertices[index];
+    }
+
+    // Индекс вершины или -1, если её нет в графе
+    int IndexOf(const T& vertex) const 
+    {
+        const int* index = indices.TryGet(vertex);
+        return index != nullptr ? *index : -1;
+    }
+
+    bool HasVertex(const T& vertex) const 
+    {
+        return indices.ContainsKey(vertex);
+    }
+
+    int GetDegree(int index) const 
+    {
+        checkIndex(index);
+        return offsets[index + 1] - offsets[index];
+    }
+
+    NeighborSpan GetNeighbors(int index) const 
+    {
+        checkIndex(index);
+        int begin = offsets[index];
+        return NeighborSpan(targets.Data() + begin, weights.Data() + begin, offsets[index + 1] - begin);
+    }
+
+    // Поиск дуги двоичным поиском по отсортированным соседям
+    bool HasArc(int from, int to) const 
+    {
+        NeighborSpan neighbors = GetNeighbors(from);
+        return std::binary_search(neighbors.begin(), neighbors.end(), to);
+    }
+
+    double GetArcWeight(int from, int to) const 
+    {
+        NeighborSpan neighbors = GetNeighbors(from);
+        const int* position = std::lower_bound(neighbors.begin(), neighbors.end(), to);
+        if (position == neighbors.end() || *position != to) 
+        {
+            throw std::runtime_error("Edge does not exist");
+        }
+        return neighbors.Weight(static_cast<int>(position - neighbors.begin()));
+    }
+};
+
+#endif // CSR_GRAPH_H
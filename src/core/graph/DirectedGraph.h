@@ -12,6 +12,7 @@ class DirectedGraph : public GraphBase<T>
 {
 private:
     Dictionary<T, Dictionary<T, double>> adjMatrix;
+    Dictionary<T, Dictionary<T, double>> reverseAdj;   // входящие рёбра: to -> (from -> вес)
     Set<T> vertices;
     mutable MutableArraySequence<T>* cachedVertices;
 
@@ -31,6 +32,7 @@ public:
     {
         vertices = other.vertices;
         adjMatrix = other.adjMatrix;
+        reverseAdj = other.reverseAdj;
         this->vertexCount = other.vertexCount;
         this->edgeCount = other.edgeCount;
         cachedVertices = nullptr;
@@ -43,6 +45,7 @@ public:
             Clear();
             vertices = other.vertices;
             adjMatrix = other.adjMatrix;
+            reverseAdj = other.reverseAdj;
             this->vertexCount = other.vertexCount;
             this->edgeCount = other.edgeCount;
             invalidateCache();
@@ -60,7 +63,8 @@ public:
         if (!vertices.Contains(vertex)) 
         {
             vertices.Add(vertex);
-            adjMatrix.Add(vertex, Dictionary<T, double>());
+            adjMatrix.Emplace(vertex);
+            reverseAdj.Emplace(vertex);
             this->vertexCount++;
             invalidateCache();
         }
@@ -71,18 +75,12 @@ public:
         AddVertex(from);
         AddVertex(to);
         
-        // Получаем словарь смежности для вершины from
-        Dictionary<T, double> adjDict = adjMatrix.Get(from);
-        
-        // Проверяем, существует ли уже ребро
-        if (!adjDict.ContainsKey(to)) 
+        // Добавляем или обновляем ребро прямо в словаре смежности вершины from
+        if (adjMatrix.GetOrInsert(from).Upsert(to, weight)) 
         {
             this->edgeCount++;
         }
-        
-        // Добавляем или обновляем ребро
-        adjDict.Add(to, weight);
-        adjMatrix.Add(from, adjDict);
+        reverseAdj.GetOrInsert(to).Upsert(from, weight);
         invalidateCache();
     }
 
@@ -90,24 +88,30 @@ public:
     {
         if (!HasVertex(vertex)) return;
         
-        // Удаляем все исходящие рёбра
-        if (adjMatrix.ContainsKey(vertex)) 
+        // Исходящие рёбра: убираем вершину из входящих у её соседей, O(deg)
+        const Dictionary<T, double>* outgoing = adjMatrix.TryGet(vertex);
+        outgoing->ForEachKey([&](const T& to) 
         {
-            this->edgeCount -= adjMatrix.Get(vertex).GetCount();
-            adjMatrix.Remove(vertex);
-        }
+            if (to != vertex) 
+            {
+                reverseAdj.TryGet(to)->Remove(vertex);
+            }
+        });
+        this->edgeCount -= outgoing->GetCount();
         
-        // Удаляем все входящие рёбра
-        // Проходим по всем вершинам
-        vertices.ForEach([&](const T& v) 
+        // Входящие рёбра: удаляем их у предшественников, не просматривая все вершины
+        const Dictionary<T, double>* incoming = reverseAdj.TryGet(vertex);
+        incoming->ForEachKey([&](const T& from) 
         {
-            if (v != vertex && adjMatrix.ContainsKey(v) && adjMatrix.Get(v).ContainsKey(vertex)) 
+            if (from != vertex) 
             {
-                adjMatrix.Get(v).Remove(vertex);
+                adjMatrix.TryGet(from)->Remove(vertex);
                 this->edgeCount--;
             }
         });
         
+        adjMatrix.Remove(vertex);
+        reverseAdj.Remove(vertex);
         vertices.Remove(vertex);
         this->vertexCount--;
         invalidateCache();
@@ -117,10 +121,8 @@ public:
     {
         if (HasEdge(from, to)) 
         {
-            // Получаем текущий словарь, удаляем ребро, обновляем
-            Dictionary<T, double> adjDict = adjMatrix.Get(from);
-            adjDict.Remove(to);
-            adjMatrix.Add(from, adjDict);
+            adjMatrix.TryGet(from)->Remove(to);
+            reverseAdj.TryGet(to)->Remove(from);
             this->edgeCount--;
             invalidateCache();
         }
@@ -133,33 +135,32 @@ public:
 
     bool HasEdge(T from, T to) const override 
     {
-        if (!HasVertex(from) || !HasVertex(to)) return false;
-        
-        // Проверяем, есть ли ключ 'from' в словаре
-        if (!adjMatrix.ContainsKey(from)) return false;
-        
-        return adjMatrix.Get(from).ContainsKey(to);
+        // Словарь смежности есть только у существующих вершин
+        const Dictionary<T, double>* adjDict = adjMatrix.TryGet(from);
+        return adjDict != nullptr && adjDict->ContainsKey(to);
     }
 
     double GetEdgeWeight(T from, T to) const override 
     {
-        if (!HasEdge(from, to)) 
+        const Dictionary<T, double>* adjDict = adjMatrix.TryGet(from);
+        const double* weight = adjDict != nullptr ? adjDict->TryGet(to) : nullptr;
+        if (weight == nullptr) 
         {
             throw std::runtime_error("Edge does not exist");
         }
-        return adjMatrix.Get(from).Get(to);
+        return *weight;
     }
 
     void SetEdgeWeight(T from, T to, double weight) override 
     {
-        if (!HasEdge(from, to)) 
+        Dictionary<T, double>* adjDict = adjMatrix.TryGet(from);
+        double* current = adjDict != nullptr ? adjDict->TryGet(to) : nullptr;
+        if (current == nullptr) 
         {
             throw std::runtime_error("Edge does not exist");
         }
-        // Получаем текущий словарь, обновляем, сохраняем обратно
-        Dictionary<T, double> adjDict = adjMatrix.Get(from);
-        adjDict.Add(to, weight);
-        adjMatrix.Add(from, adjDict);
+        *current = weight;
+        *reverseAdj.TryGet(to)->TryGet(from) = weight;
     }
 
     Sequence<T>* GetAdjacentVertices(T vertex) const override 
@@ -172,10 +173,9 @@ public:
         auto* result = new MutableArraySequence<T>();
         
         // Проверяем, есть ли вершина в словаре смежности
-        if (adjMatrix.ContainsKey(vertex)) 
+        if (const Dictionary<T, double>* adjDict = adjMatrix.TryGet(vertex)) 
         {
-            auto dict = adjMatrix.Get(vertex);
-            dict.ForEachKey([result](const T& key) 
+            adjDict->ForEachKey([result](const T& key) 
             {
                 result->Append(key);
             });
@@ -184,7 +184,35 @@ public:
         return result;
     }
 
-    // Получение вершин, входящих в данную
+    void ForEachVertex(const std::function<void(const T&)>& func) const override 
+    {
+        vertices.ForEach(func);
+    }
+
+    void ForEachEdgeFrom(T vertex, const std::function<void(const T&, double)>& func) const override 
+    {
+        if (!HasVertex(vertex)) 
+        {
+            throw std::runtime_error("Vertex does not exist");
+        }
+        if (const Dictionary<T, double>* adjDict = adjMatrix.TryGet(vertex)) 
+        {
+            adjDict->ForEach(func);
+        }
+    }
+
+    // Обход входящих рёбер вершины: func(from, weight)
+    template <typename Func>
+    void ForEachEdgeTo(T vertex, Func func) const 
+    {
+        if (!HasVertex(vertex)) 
+        {
+            throw std::runtime_error("Vertex does not exist");
+        }
+        reverseAdj.TryGet(vertex)->ForEach(func);
+    }
+
+    // Получение вершин, входящих в данную (без петли), O(deg)
     Sequence<T>* GetIncomingVertices(T vertex) const 
     {
         if (!HasVertex(vertex)) {
@@ -192,18 +220,38 @@ public:
         }
         
         auto* result = new MutableArraySequence<T>();
-        
-        // Проходим по всем вершинам и ищем те, у которых есть ребро в vertex
-        vertices.ForEach([&](const T& v) {
-            if (v != vertex && HasEdge(v, vertex)) 
+        reverseAdj.TryGet(vertex)->ForEachKey([&](const T& from) 
+        {
+            if (from != vertex) 
             {
-                result->Append(v);
+                result->Append(from);
             }
         });
         
         return result;
     }
 
+    // Число входящих и исходящих рёбер (петля учитывается в обоих), O(log V)
+    int InDegree(T vertex) const 
+    {
+        const Dictionary<T, double>* incoming = reverseAdj.TryGet(vertex);
+        if (incoming == nullptr) 
+        {
+            throw std::runtime_error("Vertex does not exist");
+        }
+        return incoming->GetCount();
+    }
+
+    int OutDegree(T vertex) const 
+    {
+        const Dictionary<T, double>* outgoing = adjMatrix.TryGet(vertex);
+        if (outgoing == nullptr) 
+        {
+            throw std::runtime_error("Vertex does not exist");
+        }
+        return outgoing->GetCount();
+    }
+
     Sequence<T>* GetAllVertices() const override 
     {
         if (!cachedVertices) {
@@ -220,6 +268,7 @@ public:
     {
         vertices.Clear();
         adjMatrix.Clear();
+        reverseAdj.Clear();
         this->vertexCount = 0;
         this->edgeCount = 0;
         invalidateCache();
@@ -236,16 +285,12 @@ public:
         });
         
         // Сохраняем рёбра
-        vertices.ForEach([&](const T& from) 
+        adjMatrix.ForEach([&](const T& from, const Dictionary<T, double>& dict) 
         {
-            if (adjMatrix.ContainsKey(from)) 
+            dict.ForEach([&](const T& to, double weight) 
             {
-                auto dict = adjMatrix.Get(from);
-                dict.ForEach([&](const T& to, double weight) 
-                {
-                    os << from << " " << to << " " << weight << "\n";
-                });
-            }
+                os << from << " " << to << " " << weight << "\n";
+            });
         });
     }
 
@@ -5,8 +5,10 @@
 #include "../structures/Set.h"
 #include "../structures/Sequence.h"
 #include "../structures/LinkedList.h"
+#include "../structures/deque.h"
 #include <stdexcept>
 #include <iostream>
+#include <functional>
 
 template<typename T>
 class GraphBase 
@@ -37,6 +39,29 @@ public:
     virtual int GetEdgeCount() const { return edgeCount; }
     virtual bool IsDirected() const { return directed; }
 
+    // Обход вершин и исходящих рёбер без создания промежуточных последовательностей.
+    // Реализации по умолчанию работают через GetAllVertices/GetAdjacentVertices
+    virtual void ForEachVertex(const std::function<void(const T&)>& func) const 
+    {
+        auto vertices = GetAllVertices();
+        for (int i = 0; i < vertices->GetLength(); i++) 
+        {
+            func(vertices->Get(i));
+        }
+        delete vertices;
+    }
+
+    virtual void ForEachEdgeFrom(T vertex, const std::function<void(const T&, double)>& func) const 
+    {
+        auto adj = GetAdjacentVertices(vertex);
+        for (int i = 0; i < adj->GetLength(); i++) 
+        {
+            T to = adj->Get(i);
+            func(to, GetEdgeWeight(vertex, to));
+        }
+        delete adj;
+    }
+
     virtual void Clear() = 0;
     
     // Сериализация в строку (для вывода)
@@ -71,74 +96,63 @@ public:
 };
 
 
+// Стек и очередь для обходов графа на кольцевом буфере: все операции O(1)
 template<typename T>
 class Stack 
 {
 private:
-    LinkedList<T> list;
+    Deque<T> items;
     
 public:
     void Push(const T& value) 
     {
-        list.Prepend(value);
+        items.PushBack(value);
     }
     
     T Pop() 
     {
-        if (list.GetLength() == 0) throw std::runtime_error("Stack is empty");
-        T value = list.GetFirst();
-
-        LinkedList<T> newList;
-        for (int i = 1; i < list.GetLength(); i++) 
-        {
-            newList.Append(list.Get(i));
-        }
-        list = newList;
-        return value;
+        if (items.IsEmpty()) throw std::runtime_error("Stack is empty");
+        return items.PopBack();
     }
     
     T Top() const 
     {
-        if (list.GetLength() == 0) throw std::runtime_error("Stack is empty");
-        return list.GetFirst();
+        if (items.IsEmpty()) throw std::runtime_error("Stack is empty");
+        return items.Back();
     }
     
-    bool IsEmpty() const { return list.GetLength() == 0; }
-    int Size() const { return list.GetLength(); }
+    void Reserve(int capacity) { items.Reserve(capacity); }
+    bool IsEmpty() const { return items.IsEmpty(); }
+    int Size() const { return items.GetCount(); }
 };
 
 template<typename T>
 class Queue 
 {
 private:
-    LinkedList<T> list;
+    Deque<T> items;
     
 public:
     void Enqueue(const T& value) 
     {
-        list.Append(value);
+        items.PushBack(value);
     }
     
     T Dequeue() 
     {
-        if (list.GetLength() == 0) throw std::runtime_error("Queue is empty");
-        T value = list.GetFirst();
-        LinkedList<T> newList;
-        for (int i = 1; i < list.GetLength(); i++) {
-            newList.Append(list.Get(i));
-        }
-        list = newList;
-        return value;
+        if (items.IsEmpty()) throw std::runtime_error("Queue is empty");
+        return items.PopFront();
     }
     
     T Front() const 
     {
-        if (list.GetLength() == 0) throw std::runtime_error("Queue is empty");
-        return list.GetFirst();
+        if (items.IsEmpty()) throw std::runtime_error("Queue is empty");
+        return items.Front();
     }
     
-    bool IsEmpty() const { return list.GetLength() == 0; }
-    int Size() const { return list.GetLength(); }
+    void Reserve(int capacity) { items.Reserve(capacity); }
+    bool IsEmpty() const { return items.IsEmpty(); }
+    int Size() const { return items.GetCount(); }
 };
 
 #endif // GRAPH_BASE_H
\ No newline at end of file
@@ -59,7 +59,7 @@ public:
         if (!vertices.Contains(vertex)) 
         {
             vertices.Add(vertex);
-            adjMatrix.Add(vertex, Dictionary<T, double>());
+            adjMatrix.Emplace(vertex);
             this->vertexCount++;
             invalidateCache();
         }
@@ -71,23 +71,10 @@ public:
         AddVertex(to);
         
         // Для неориентированного графа добавляем ребро в обе стороны
-        Dictionary<T, double> adjDictFrom = adjMatrix.Get(from);
-        Dictionary<T, double> adjDictTo = adjMatrix.Get(to);
-        
-        // Проверяем, существует ли уже ребро
-        bool edgeExists = adjDictFrom.ContainsKey(to);
-        
-        if (!edgeExists) {
+        if (adjMatrix.GetOrInsert(from).Upsert(to, weight)) {
             this->edgeCount++; // В неориентированном графе считаем ребро один раз
         }
-        
-        // Добавляем в обе стороны
-        adjDictFrom.Add(to, weight);
-        adjDictTo.Add(from, weight);
-        
-        // Сохраняем обратно
-        adjMatrix.Add(from, adjDictFrom);
-        adjMatrix.Add(to, adjDictTo);
+        adjMatrix.GetOrInsert(to).Upsert(from, weight);
         
         invalidateCache();
     }
@@ -97,21 +84,19 @@ public:
         if (!HasVertex(vertex)) return;
         
         // Удаляем все рёбра, связанные с вершиной
-        Dictionary<T, double> adjDict = adjMatrix.Get(vertex);
+        const Dictionary<T, double>* adjDict = adjMatrix.TryGet(vertex);
         
-        // Удаляем рёбра из других вершин
-        adjDict.ForEachKey([&](const T& neighbor) 
+        // Удаляем рёбра из других вершин (петля удалится вместе со словарём вершины)
+        adjDict->ForEachKey([&](const T& neighbor) 
         {
-            Dictionary<T, double> neighborDict = adjMatrix.Get(neighbor);
-            if (neighborDict.ContainsKey(vertex)) 
+            if (neighbor != vertex) 
             {
-                neighborDict.Remove(vertex);
-                adjMatrix.Add(neighbor, neighborDict);
+                adjMatrix.TryGet(neighbor)->Remove(vertex);
             }
         });
         
         // Удаляем вершину
-        this->edgeCount -= adjDict.GetCount();
+        this->edgeCount -= adjDict->GetCount();
         adjMatrix.Remove(vertex);
         vertices.Remove(vertex);
         this->vertexCount--;
@@ -123,14 +108,8 @@ public:
         if (HasEdge(from, to)) 
         {
             // Удаляем в обе стороны
-            Dictionary<T, double> adjDictFrom = adjMatrix.Get(from);
-            Dictionary<T, double> adjDictTo = adjMatrix.Get(to);
-            
-            adjDictFrom.Remove(to);
-            adjDictTo.Remove(from);
-            
-            adjMatrix.Add(from, adjDictFrom);
-            adjMatrix.Add(to, adjDictTo);
+            adjMatrix.TryGet(from)->Remove(to);
+            adjMatrix.TryGet(to)->Remove(from);
             
             this->edgeCount--;
             invalidateCache();
@@ -144,23 +123,20 @@ public:
 
     bool HasEdge(T from, T to) const override 
     {
-        if (!HasVertex(from) || !HasVertex(to)) return false;
-        
-        if (!adjMatrix.ContainsKey(from)) return false;
-        
-        Dictionary<T, double> adjDict = adjMatrix.Get(from);
-        return adjDict.ContainsKey(to);
+        // Словарь смежности есть только у существующих вершин
+        const Dictionary<T, double>* adjDict = adjMatrix.TryGet(from);
+        return adjDict != nullptr && adjDict->ContainsKey(to);
     }
 
     double GetEdgeWeight(T from, T to) const override 
     {
-        if (!HasEdge(from, to)) 
+        const Dictionary<T, double>* adjDict = adjMatrix.TryGet(from);
+        const double* weight = adjDict != nullptr ? adjDict->TryGet(to) : nullptr;
+        if (weight == nullptr) 
         {
             throw std::runtime_error("Edge does not exist");
         }
-        
-        Dictionary<T, double> adjDict = adjMatrix.Get(from);
-        return adjDict.Get(to);
+        return *weight;
     }
 
     void SetEdgeWeight(T from, T to, double weight) override 
@@ -171,14 +147,8 @@ public:
         }
         
         // Обновляем в обе стороны
-        Dictionary<T, double> adjDictFrom = adjMatrix.Get(from);
-        Dictionary<T, double> adjDictTo = adjMatrix.Get(to);
-        
-        adjDictFrom.Add(to, weight);
-        adjDictTo.Add(from, weight);
-        
-        adjMatrix.Add(from, adjDictFrom);
-        adjMatrix.Add(to, adjDictTo);
+        *adjMatrix.TryGet(from)->TryGet(to) = weight;
+        *adjMatrix.TryGet(to)->TryGet(from) = weight;
     }
 
     Sequence<T>* GetAdjacentVertices(T vertex) const override 
@@ -189,10 +159,9 @@ public:
         
         auto* result = new MutableArraySequence<T>();
         
-        if (adjMatrix.ContainsKey(vertex)) 
+        if (const Dictionary<T, double>* adjDict = adjMatrix.TryGet(vertex)) 
         {
-            Dictionary<T, double> adjDict = adjMatrix.Get(vertex);
-            adjDict.ForEachKey([result](const T& key) 
+            adjDict->ForEachKey([result](const T& key) 
             {
                 result->Append(key);
             });
@@ -201,6 +170,23 @@ public:
         return result;
     }
 
+    void ForEachVertex(const std::function<void(const T&)>& func) const override 
+    {
+        vertices.ForEach(func);
+    }
+
+    void ForEachEdgeFrom(T vertex, const std::function<void(const T&, double)>& func) const override 
+    {
+        if (!HasVertex(vertex)) 
+        {
+            throw std::runtime_error("Vertex does not exist");
+        }
+        if (const Dictionary<T, double>* adjDict = adjMatrix.TryGet(vertex)) 
+        {
+            adjDict->ForEach(func);
+        }
+    }
+
     Sequence<T>* GetAllVertices() const override 
     {
         if (!cachedVertices) {
@@ -239,9 +225,8 @@ public:
         for (int i = 0; i < allVertices->GetLength(); i++) 
         {
             T from = allVertices->Get(i);
-            if (adjMatrix.ContainsKey(from)) {
-                Dictionary<T, double> adjDict = adjMatrix.Get(from);
-                adjDict.ForEach([&](const T& to, double weight) 
+            if (const Dictionary<T, double>* adjDict = adjMatrix.TryGet(from)) {
+                adjDict->ForEach([&](const T& to, double weight) 
                 {
                     // Сохраняем ребро только один раз
                     if (from < to) 
@@ -2,6 +2,7 @@
 #define DYNAMICARRAY_H
 
 #include <stdexcept>
+#include <utility>
 
 template <class T>
 class DynamicArray 
@@ -9,15 +10,38 @@ class DynamicArray
 private:
     T* items;
     int size;
+    int capacity;   // число выделенных ячеек, capacity >= size
+
+    // Переносит элементы в новый буфер ёмкостью newCapacity (перемещением, без копирования)
+    void reallocate(int newCapacity) 
+    {
+        T* newItems = new T[newCapacity]();
+        for (int i = 0; i < size; i++) 
+        {
+            newItems[i] = std::move(items[i]);
+        }
+        delete[] items;
+        items = newItems;
+        capacity = newCapacity;
+    }
+
+    // Геометрический рост ёмкости: амортизированно O(1) на добавление
+    void ensureCapacity(int required) 
+    {
+        if (required <= capacity) return;
+        int newCapacity = capacity < 4 ? 4 : capacity * 2;
+        if (newCapacity < required) newCapacity = required;
+        reallocate(newCapacity);
+    }
 
 public:
-    DynamicArray() : items(nullptr), size(0) {}
-    DynamicArray(int size) : size(size) 
+    DynamicArray() : items(nullptr), size(0), capacity(0) {}
+    DynamicArray(int size) : size(size), capacity(size) 
     {
         if (size < 0) throw std::invalid_argument("Размер не может быть отрицательным");
         items = new T[size]();
     }
-    DynamicArray(T* items, int count) : size(count) 
+    DynamicArray(T* items, int count) : size(count), capacity(count) 
     {
         if (count < 0) throw std::invalid_argument("Количество не может быть отрицательным");
         this->items = new T[size];
@@ -26,7 +50,7 @@ public:
             this->items[i] = items[i];
         }
     }
-    DynamicArray(const DynamicArray<T>& other) : size(other.size) 
+    DynamicArray(const DynamicArray<T>& other) : size(other.size), capacity(other.size) 
     {
         items = new T[size];
         for (int i = 0; i < size; i++) 
@@ -34,10 +58,11 @@ public:
             items[i] = other.items[i];
         }
     }
-    DynamicArray(DynamicArray<T>&& other) noexcept : items(other.items), size(other.size) 
+    DynamicArray(DynamicArray<T>&& other) noexcept : items(other.items), size(other.size), capacity(other.capacity) 
     {
         other.items = nullptr;
         other.size = 0;
+        other.capacity = 0;
     }
     ~DynamicArray() 
     {
@@ -49,6 +74,7 @@ public:
         {
             delete[] items;
             size = other.size;
+            capacity = other.size;
             items = new T[size];
             for (int i = 0; i < size; i++) 
             {
@@ -64,8 +90,10 @@ public:
             delete[] items;
             items = other.items;
             size = other.size;
+            capacity = other.capacity;
             other.items = nullptr;
             other.size = 0;
+            other.capacity = 0;
         }
         return *this;
     }
@@ -91,41 +119,121 @@ public:
     {
         return size;
     }
+    // Указатель на непрерывный буфер элементов (для внутренних циклов без проверки индекса)
+    T* Data() 
+    {
+        return items;
+    }
+    const T* Data() const 
+    {
+        return items;
+    }
+    int GetCapacity() const 
+    {
+        return capacity;
+    }
     void Set(int index, T value) 
     {
         operator[](index) = value;
     }
+    // Изменяет размер; новые элементы инициализируются значением по умолчанию.
+    // Память перевыделяется, только если newSize превышает ёмкость
     void Resize(int newSize) 
     {
         if (newSize < 0) throw std::invalid_argument("Размер не может быть отрицательным");
         if (newSize == size) return;
-        T* newItems = new T[newSize]();
-        int copySize;
-        if (newSize < size)
+        if (newSize > capacity) 
         {
-            copySize = newSize;
+            reallocate(newSize);
         }
-        else
+        for (int i = newSize; i < size; i++) 
         {
-            copySize = size;
+            items[i] = T();
         }
-        for (int i = 0; i < copySize; i++) 
+        for (int i = size; i < newSize; i++) 
         {
-            newItems[i] = items[i];
+            items[i] = T();
         }
-        delete[] items;
-        items = newItems;
         size = newSize;
     }
+    // Резервирует память под newCapacity элементов без изменения размера
+    void Reserve(int newCapacity) 
+    {
+        if (newCapacity < 0) throw std::invalid_argument("Размер не может быть отрицательным");
+        if (newCapacity > capacity) 
+        {
+            reallocate(newCapacity);
+        }
+    }
+    // Освобождает неиспользуемую ёмкость
+    void ShrinkToFit() 
+    {
+        if (capacity == size) return;
+        if (size == 0) 
+        {
+            delete[] items;
+            items = nullptr;
+            capacity = 0;
+            return;
+        }
+        reallocate(size);
+    }
+    void PushBack(const T& item) 
+    {
+        if (size == capacity) 
+        {
+            // item может ссылаться на элемент этого же массива
+            T copy = item;
+            ensureCapacity(size + 1);
+            items[size++] = std::move(copy);
+            return;
+        }
+        items[size++] = item;
+    }
+    void PushBack(T&& item) 
+    {
+        if (size == capacity) 
+        {
+            // item может ссылаться на элемент этого же массива
+            T moved = std::move(item);
+            ensureCapacity(size + 1);
+            items[size++] = std::move(moved);
+            return;
+        }
+        items[size++] = std::move(item);
+    }
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) 
+    {
+        // Аргументы могут ссылаться на элементы этого же массива: элемент строится до перевыделения
+        T item(std::forward<Args>(args)...);
+        ensureCapacity(size + 1);
+        items[size] = std::move(item);
+        return items[size++];
+    }
+    void PopBack() 
+    {
+        if (size == 0) throw std::out_of_range("Массив пуст");
+        items[--size] = T();
+    }
+    void Clear() 
+    {
+        for (int i = 0; i < size; i++) 
+        {
+            items[i] = T();
+        }
+        size = 0;
+    }
     void InsertAt(T item, int index) 
     {
         if (index < 0 || index > size) throw std::out_of_range("Индекс вне диапазона");
-        Resize(size + 1);
-        for (int i = size - 1; i > index; i--) 
+        ensureCapacity(size + 1);
+        for (int i = size; i > index; i--) 
         {
-            items[i] = items[i - 1];
+            items[i] = std::move(items[i - 1]);
         }
-        items[index] = item;
+        items[index] = std::move(item);
+        size++;
     }
 };
 
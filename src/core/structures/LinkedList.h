@@ -1,9 +1,13 @@
 #ifndef LINKEDLIST_H
 #define LINKEDLIST_H
 
+#include "node_pool.h"
 #include <stdexcept>
+#include <utility>
 
-template <class T>
+// Односвязный список с указателем на хвост: добавление в начало и конец - O(1).
+// TAllocator = PooledNodeAllocator берёт узлы из пула вместо отдельного new на каждый узел
+template <class T, class TAllocator = HeapNodeAllocator>
 class LinkedList 
 {
 private:
@@ -11,34 +15,88 @@ private:
     {
         T data;
         Node* next;
-        Node(T value, Node* next = nullptr) : data(value), next(next) {}
+        Node(T value, Node* next = nullptr) : data(std::move(value)), next(next) {}
     };
+    typedef NodeAllocation<TAllocator> Allocation;
+
     Node* head;
+    Node* tail;
     int length;
+    Node* CreateNode(T value, Node* next = nullptr) 
+    {
+        return Allocation::template Create<Node>(std::move(value), next);
+    }
     void Clear() 
     {
         while (head) 
         {
             Node* temp = head;
             head = head->next;
-            delete temp;
+            Allocation::Destroy(temp);
         }
+        tail = nullptr;
         length = 0;
     }
-    void CopyFrom(const LinkedList<T>& other) 
+    void CopyFrom(const LinkedList& other) 
     {
         Node** current = &head;
         Node* otherCurrent = other.head;
         while (otherCurrent) 
         {
-            *current = new Node(otherCurrent->data);
+            *current = CreateNode(otherCurrent->data);
+            tail = *current;
             current = &((*current)->next);
             otherCurrent = otherCurrent->next;
         }
         length = other.length;
     }
+    Node* NodeAt(int index) const 
+    {
+        if (index < 0 || index >= length) throw std::out_of_range("Индекс вне диапазона");
+        if (index == length - 1) return tail;
+        Node* current = head;
+        for (int i = 0; i < index; i++) 
+        {
+            current = current->next;
+        }
+        return current;
+    }
+    void TakeFrom(LinkedList& other) 
+    {
+        head = other.head;
+        tail = other.tail;
+        length = other.length;
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.length = 0;
+    }
 public:
-    LinkedList() : head(nullptr), length(0) {}
+    // Курсор для последовательного обхода узлов без поиска по индексу
+    class Cursor 
+    {
+    private:
+        const Node* node;
+    public:
+        explicit Cursor(const Node* node = nullptr) : node(node) {}
+        bool IsValid() const 
+        {
+            return node != nullptr;
+        }
+        const T& Get() const 
+        {
+            if (!node) throw std::out_of_range("Iterator is out of range");
+            return node->data;
+        }
+        void Next() 
+        {
+            if (node) 
+            {
+                node = node->next;
+            }
+        }
+    };
+
+    LinkedList() : head(nullptr), tail(nullptr), length(0) {}
     LinkedList(T* items, int count) : LinkedList() 
     {
         for (int i = 0; i < count; i++) 
@@ -46,20 +104,19 @@ public:
             Append(items[i]);
         }
     }
-    LinkedList(const LinkedList<T>& other) : LinkedList() 
+    LinkedList(const LinkedList& other) : LinkedList() 
     {
         CopyFrom(other);
     }
-    LinkedList(LinkedList<T>&& other) noexcept : head(other.head), length(other.length) 
+    LinkedList(LinkedList&& other) noexcept : LinkedList() 
     {
-        other.head = nullptr;
-        other.length = 0;
+        TakeFrom(other);
     }
     ~LinkedList() 
     {
         Clear();
     }
-    LinkedList<T>& operator=(const LinkedList<T>& other) 
+    LinkedList& operator=(const LinkedList& other) 
     {
         if (this != &other) 
         {
@@ -68,15 +125,12 @@ public:
         }
         return *this;
     }
-    LinkedList<T>& operator=(LinkedList<T>&& other) noexcept 
+    LinkedList& operator=(LinkedList&& other) noexcept 
     {
         if (this != &other) 
         {
             Clear();
-            head = other.head;
-            length = other.length;
-            other.head = nullptr;
-            other.length = 0;
+            TakeFrom(other);
         }
         return *this;
     }
@@ -90,23 +144,11 @@ public:
     }
     T& Get(int index) 
     {
-        if (index < 0 || index >= length) throw std::out_of_range("Индекс вне диапазона");
-        Node* current = head;
-        for (int i = 0; i < index; i++) 
-        {
-            current = current->next;
-        }
-        return current->data;
+        return NodeAt(index)->data;
     }
     const T& Get(int index) const 
     {
-        if (index < 0 || index >= length) throw std::out_of_range("Индекс вне диапазона");
-        Node* current = head;
-        for (int i = 0; i < index; i++) 
-        {
-            current = current->next;
-        }
-        return current->data;
+        return NodeAt(index)->data;
     }
     T& GetFirst() 
     {
@@ -120,28 +162,22 @@ public:
     }
     T& GetLast() 
     {
-        if (!head) throw std::runtime_error("Список пуст");
-        Node* current = head;
-        while (current->next) 
-        {
-            current = current->next;
-        }
-        return current->data;
+        if (!tail) throw std::runtime_error("Список пуст");
+        return tail->data;
     }
     const T& GetLast() const 
     {
-        if (!head) throw std::runtime_error("Список пуст");
-        Node* current = head;
-        while (current->next) 
-        {
-            current = current->next;
-        }
-        return current->data;
+        if (!tail) throw std::runtime_error("Список пуст");
+        return tail->data;
+    }
+    Cursor Begin() const 
+    {
+        return Cursor(head);
     }
-    LinkedList<T> GetSubList(int startIndex, int endIndex) const 
+    LinkedList GetSubList(int startIndex, int endIndex) const 
     {
         if (startIndex < 0 || endIndex >= length || startIndex > endIndex) throw std::out_of_range("Invalid index range");
-        LinkedList<T> sublist;
+        LinkedList sublist;
         Node* current = head;
         for (int i = 0; i <= endIndex; i++) 
         {
@@ -159,33 +195,94 @@ public:
     }
     void Append(T item) 
     {
-        Node** current = &head;
-        while (*current) 
+        Node* node = CreateNode(std::move(item));
+        if (tail) 
         {
-            current = &((*current)->next);
+            tail->next = node;
         }
-        *current = new Node(item);
+        else 
+        {
+            head = node;
+        }
+        tail = node;
         length++;
     }
     void Prepend(T item) 
     {
-        head = new Node(item, head);
+        head = CreateNode(std::move(item), head);
+        if (!tail) 
+        {
+            tail = head;
+        }
         length++;
     }
     void InsertAt(T item, int index) 
     {
         if (index < 0 || index > length) throw std::out_of_range("Index out of range");
+        if (index == length) 
+        {
+            Append(std::move(item));
+            return;
+        }
         Node** current = &head;
         for (int i = 0; i < index; i++) 
         {
             current = &((*current)->next);
         }
-        *current = new Node(item, *current);
+        *current = CreateNode(std::move(item), *current);
         length++;
     }
-    LinkedList<T> Concat(const LinkedList<T>& other) const 
+    // Удаляет первый элемент за O(1)
+    T RemoveFirst() 
+    {
+        if (!head) throw std::runtime_error("Список пуст");
+        Node* node = head;
+        head = head->next;
+        if (!head) 
+        {
+            tail = nullptr;
+        }
+        length--;
+        T value = std::move(node->data);
+        Allocation::Destroy(node);
+        return value;
+    }
+    // Переносит все узлы other в конец списка за O(1), other становится пустым
+    void Splice(LinkedList& other) 
     {
-        LinkedList<T> result(*this);
+        if (this == &other || !other.head) return;
+        if (tail) 
+        {
+            tail->next = other.head;
+        }
+        else 
+        {
+            head = other.head;
+        }
+        tail = other.tail;
+        length += other.length;
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.length = 0;
+    }
+    // Переносит все узлы other в начало списка за O(1), other становится пустым
+    void SpliceFront(LinkedList& other) 
+    {
+        if (this == &other || !other.head) return;
+        other.tail->next = head;
+        head = other.head;
+        if (!tail) 
+        {
+            tail = other.tail;
+        }
+        length += other.length;
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.length = 0;
+    }
+    LinkedList Concat(const LinkedList& other) const 
+    {
+        LinkedList result(*this);
         Node* current = other.head;
         while (current) 
         {
@@ -194,6 +291,13 @@ public:
         }
         return result;
     }
+    // Конкатенация без копирования узлов: оба списка-операнда опустошаются
+    static LinkedList Concat(LinkedList&& first, LinkedList&& second) 
+    {
+        LinkedList result(std::move(first));
+        result.Splice(second);
+        return result;
+    }
 };
 
-#endif
\ No newline at end of file
+#endif
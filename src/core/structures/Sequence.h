@@ -90,41 +90,35 @@ public:
     }
 };
 
+// Итератор списка идёт по узлам, а не по индексам, поэтому полный обход - O(n)
 template <class T>
 class ListIterator : public IIterator<T> 
 {
 private:
     const ImmutableListSequence<T>* sequence;
-    int currentIndex;
+    typename LinkedList<T>::Cursor cursor;
 
 public:
-    ListIterator(const ImmutableListSequence<T>* seq) : sequence(seq), currentIndex(0) {}
+    ListIterator(const ImmutableListSequence<T>* seq) : sequence(seq), cursor(seq->list.Begin()) {}
 
     T GetCurrentItem() const override 
     {
-        if (currentIndex < 0 || currentIndex >= sequence->GetLength()) 
-        {
-            throw std::out_of_range("Iterator is out of range");
-        }
-        return sequence->Get(currentIndex);
+        return cursor.Get();
     }
 
     bool HasNext() const override 
     {
-        return currentIndex < sequence->GetLength();
+        return cursor.IsValid();
     }
 
     void Next() override 
     {
-        if (HasNext()) 
-        {
-            currentIndex++;
-        }
+        cursor.Next();
     }
 
     void Reset() override 
     {
-        currentIndex = 0;
+        cursor = sequence->list.Begin();
     }
 };
 
@@ -211,7 +205,7 @@ public:
     
     void Append(T item) 
     {
-        this->array.InsertAt(item, this->array.GetSize());
+        this->array.PushBack(std::move(item));
     }
     
     void Prepend(T item) 
@@ -224,6 +218,11 @@ public:
         this->array.InsertAt(item, index);
     }
     
+    void Reserve(int capacity) 
+    {
+        this->array.Reserve(capacity);
+    }
+    
     Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override 
     {
         if (startIndex < 0 || endIndex >= this->array.GetSize() || startIndex > endIndex) 
@@ -255,6 +254,8 @@ class ImmutableListSequence : public Sequence<T>
 protected:
     LinkedList<T> list;
 
+    friend class ListIterator<T>;
+
 public:
     ImmutableListSequence() : list() {}
     ImmutableListSequence(T* items, int count) : list(items, count) {}
@@ -324,6 +325,12 @@ public:
         this->list.InsertAt(item, index);
     }
     
+    // Переносит элементы other в конец последовательности за O(1), other становится пустой
+    void Splice(MutableListSequence<T>& other) 
+    {
+        this->list.Splice(other.list);
+    }
+    
     Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override 
     {
         LinkedList<T> subList = this->list.GetSubList(startIndex, endIndex);
@@ -7,6 +7,7 @@
 #include <iostream>
 #include <stdexcept>
 #include <functional>
+#include <utility>
 
 template <typename T>
 struct Node 
@@ -14,69 +15,192 @@ struct Node
     T data;
     Node* left;
     Node* right;
+    int height;
+    int size;    // число узлов в поддереве
     
-    Node(const T& value) : data(value), left(nullptr), right(nullptr) {}
+    Node(const T& value) : data(value), left(nullptr), right(nullptr), height(1), size(1) {}
 };
 
-template <typename T>
+// Balanced = true включает AVL-балансировку: высота дерева остаётся O(log n)
+// после каждой вставки и удаления, в том числе при вставке упорядоченных ключей
+template <typename T, bool Balanced = false>
 class BinaryTree 
 {
 private:
     Node<T>* root;
 
-    Node<T>* insertRecursive(Node<T>* node, const T& value)
+    static int heightOf(Node<T>* node) 
+    {
+        return node == nullptr ? 0 : node->height;
+    }
+
+    static int sizeOf(Node<T>* node) 
+    {
+        return node == nullptr ? 0 : node->size;
+    }
+
+    // Пересчитывает высоту и размер поддерева по дочерним узлам
+    static void updateNode(Node<T>* node) 
+    {
+        int leftHeight = heightOf(node->left);
+        int rightHeight = heightOf(node->right);
+        node->height = 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+        node->size = 1 + sizeOf(node->left) + sizeOf(node->right);
+    }
+
+    static Node<T>* rotateRight(Node<T>* node) 
     {
-        if (node == nullptr) 
+        Node<T>* pivot = node->left;
+        node->left = pivot->right;
+        pivot->right = node;
+        updateNode(node);
+        updateNode(pivot);
+        return pivot;
+    }
+
+    static Node<T>* rotateLeft(Node<T>* node) 
+    {
+        Node<T>* pivot = node->right;
+        node->right = pivot->left;
+        pivot->left = node;
+        updateNode(node);
+        updateNode(pivot);
+        return pivot;
+    }
+
+    // Пересчитывает узел и, в сбалансированном режиме, восстанавливает AVL-инвариант
+    static Node<T>* rebalance(Node<T>* node) 
+    {
+        updateNode(node);
+        if constexpr (Balanced) 
         {
-            return new Node<T>(value);
+            int balanceFactor = heightOf(node->left) - heightOf(node->right);
+            if (balanceFactor > 1) 
+            {
+                if (heightOf(node->left->left) < heightOf(node->left->right)) 
+                {
+                    node->left = rotateLeft(node->left);
+                }
+                return rotateRight(node);
+            }
+            if (balanceFactor < -1) 
+            {
+                if (heightOf(node->right->right) < heightOf(node->right->left)) 
+                {
+                    node->right = rotateRight(node->right);
+                }
+                return rotateLeft(node);
+            }
         }
+        return node;
+    }
+
+    // Алгоритмы ниже обходятся без рекурсии: в несбалансированном режиме дерево из упорядоченных
+    // ключей вырождается в список, и рекурсия глубины n переполнила бы стек вызовов.
+    // Явный стек выделяется один раз по высоте дерева, которая хранится в корне
 
-        if (value < node->data) 
+    // Пересчитывает узлы пути снизу вверх. path - адреса ссылок на узлы пути (root или поле
+    // left/right родителя), поэтому поворот поддерева сразу подвешивает его к родителю
+    static void rebalancePath(DynamicArray<Node<T>**>& path) 
+    {
+        for (int i = path.GetSize() - 1; i >= 0; i--) 
         {
-            node->left = insertRecursive(node->left, value);
-        } 
-        else if (node->data < value) 
+            *path[i] = rebalance(*path[i]);
+        }
+    }
+
+    // Возвращает узел с найденным или вставленным значением, inserted - был ли он создан
+    Node<T>* insertNode(const T& value, bool& inserted) 
+    {
+        DynamicArray<Node<T>**> path;
+        path.Reserve(heightOf(root) + 1);
+        Node<T>** link = &root;
+        while (*link != nullptr) 
         {
-            node->right = insertRecursive(node->right, value);
+            Node<T>* node = *link;
+            if (value < node->data) 
+            {
+                path.PushBack(link);
+                link = &node->left;
+            }
+            else if (node->data < value) 
+            {
+                path.PushBack(link);
+                link = &node->right;
+            }
+            else 
+            {
+                inserted = false;
+                return node;
+            }
         }
 
-        return node;
+        Node<T>* created = new Node<T>(value);
+        *link = created;
+        inserted = true;
+        rebalancePath(path);
+        return created;
     }
-    
-    Node<T>* removeRecursive(Node<T>* node, const T& value)
-    {
-        if (node == nullptr) return nullptr;
 
-        if (value < node->data) 
+    void removeNode(const T& value) 
+    {
+        DynamicArray<Node<T>**> path;
+        path.Reserve(heightOf(root) + 1);
+        Node<T>** link = &root;
+        while (*link != nullptr) 
         {
-            node->left = removeRecursive(node->left, value);
-        } 
-        else if (node->data < value) 
+            Node<T>* node = *link;
+            if (value < node->data) 
+            {
+                path.PushBack(link);
+                link = &node->left;
+            }
+            else if (node->data < value) 
+            {
+                path.PushBack(link);
+                link = &node->right;
+            }
+            else 
+            {
+                break;
+            }
+        }
+        if (*link == nullptr) return;
+
+        Node<T>* node = *link;
+        if (node->left == nullptr || node->right == nullptr) 
         {
-            node->right = removeRecursive(node->right, value);
-        } 
+            *link = node->left != nullptr ? node->left : node->right;
+            delete node;
+        }
         else 
         {
-            if (node->left == nullptr) 
+            // Наименьший узел правого поддерева вырезается и встаёт на место удаляемого.
+            // Узлы перевешиваются, а не обмениваются данными: указатели на значения
+            // остальных элементов остаются действительными, и значения не копируются
+            path.PushBack(link);
+            int nodeDepth = path.GetSize() - 1;
+            Node<T>** successorLink = &node->right;
+            while ((*successorLink)->left != nullptr) 
             {
-                Node<T>* temp = node->right;
-                delete node;
-                return temp;
-            } 
-            else if (node->right == nullptr) 
+                path.PushBack(successorLink);
+                successorLink = &(*successorLink)->left;
+            }
+            Node<T>* successor = *successorLink;
+            *successorLink = successor->right;
+            successor->left = node->left;
+            successor->right = node->right;
+            *link = successor;
+            // Ссылка на правое поддерево теперь хранится в successor, а не в удаляемом узле
+            if (path.GetSize() > nodeDepth + 1) 
             {
-                Node<T>* temp = node->left;
-                delete node;
-                return temp;
+                path[nodeDepth + 1] = &successor->right;
             }
-
-            Node<T>* temp = findMin(node->right);
-            node->data = temp->data;
-            node->right = removeRecursive(node->right, temp->data);
+            delete node;
         }
-        return node;
+        rebalancePath(path);
     }
-    
+
     Node<T>* findMin(Node<T>* node) const
     {
         while (node != nullptr && node->left != nullptr) 
@@ -85,41 +209,118 @@ private:
         }
         return node;
     }
-    
-    bool containsRecursive(Node<T>* node, const T& value) const
+
+    // Обходы узлов с явным стеком; visit(node) вызывается в том же порядке, что и при рекурсии
+    template <typename Visit>
+    static void preOrderNodes(Node<T>* node, Visit&& visit) 
     {
-        if (node == nullptr) return false;
-        if (node->data == value) return true;
-        if (value < node->data) return containsRecursive(node->left, value);
-        return containsRecursive(node->right, value);
+        if (node == nullptr) return;
+        DynamicArray<Node<T>*> stack;
+        stack.Reserve(heightOf(node) + 1);
+        stack.PushBack(node);
+        while (stack.GetSize() > 0) 
+        {
+            Node<T>* current = stack[stack.GetSize() - 1];
+            stack.PopBack();
+            visit(current);
+            if (current->right != nullptr) stack.PushBack(current->right);
+            if (current->left != nullptr) stack.PushBack(current->left);
+        }
     }
-    
-    void clearRecursive(Node<T>* node)
+
+    template <typename Visit>
+    static void inOrderNodes(Node<T>* node, Visit&& visit) 
     {
-        if (node != nullptr) 
+        DynamicArray<Node<T>*> stack;
+        stack.Reserve(heightOf(node));
+        Node<T>* current = node;
+        while (current != nullptr || stack.GetSize() > 0) 
         {
-            clearRecursive(node->left);
-            clearRecursive(node->right);
-            delete node;
+            while (current != nullptr) 
+            {
+                stack.PushBack(current);
+                current = current->left;
+            }
+            current = stack[stack.GetSize() - 1];
+            stack.PopBack();
+            visit(current);
+            current = current->right;
         }
     }
-    
+
+    // Узел посещается, когда его правое поддерево уже обойдено: last - последний посещённый узел
+    template <typename Visit>
+    static void postOrderNodes(Node<T>* node, Visit&& visit) 
+    {
+        DynamicArray<Node<T>*> stack;
+        stack.Reserve(heightOf(node));
+        Node<T>* current = node;
+        Node<T>* last = nullptr;
+        while (current != nullptr || stack.GetSize() > 0) 
+        {
+            if (current != nullptr) 
+            {
+                stack.PushBack(current);
+                current = current->left;
+                continue;
+            }
+            Node<T>* top = stack[stack.GetSize() - 1];
+            if (top->right != nullptr && top->right != last) 
+            {
+                current = top->right;
+            }
+            else 
+            {
+                visit(top);
+                last = top;
+                stack.PopBack();
+            }
+        }
+    }
+
+    void clearNodes(Node<T>* node) 
+    {
+        if (node == nullptr) return;
+        DynamicArray<Node<T>*> stack;
+        stack.Reserve(heightOf(node) + 1);
+        stack.PushBack(node);
+        while (stack.GetSize() > 0) 
+        {
+            Node<T>* current = stack[stack.GetSize() - 1];
+            stack.PopBack();
+            if (current->left != nullptr) stack.PushBack(current->left);
+            if (current->right != nullptr) stack.PushBack(current->right);
+            delete current;
+        }
+    }
+
+    // Копия поддерева: в стеке пары (исходный узел, ссылка, куда подвесить его копию)
     Node<T>* copyTree(Node<T>* node) const
     {
-        if (node == nullptr) return nullptr;
-        Node<T>* newNode = new Node<T>(node->data);
-        newNode->left = copyTree(node->left);
-        newNode->right = copyTree(node->right);
-        return newNode;
+        Node<T>* result = nullptr;
+        if (node == nullptr) return result;
+        DynamicArray<std::pair<Node<T>*, Node<T>**>> stack;
+        stack.Reserve(heightOf(node) + 1);
+        stack.PushBack(std::make_pair(node, &result));
+        while (stack.GetSize() > 0) 
+        {
+            std::pair<Node<T>*, Node<T>**> top = stack[stack.GetSize() - 1];
+            stack.PopBack();
+            Node<T>* source = top.first;
+            Node<T>* copy = new Node<T>(source->data);
+            copy->height = source->height;
+            copy->size = source->size;
+            *top.second = copy;
+            if (source->right != nullptr) stack.PushBack(std::make_pair(source->right, &copy->right));
+            if (source->left != nullptr) stack.PushBack(std::make_pair(source->left, &copy->left));
+        }
+        return result;
     }
     
     // Методы для балансировки
     void storeInOrder(Node<T>* node, MutableArraySequence<T>& arr) const
     {
-        if (node == nullptr) return;
-        storeInOrder(node->left, arr);
-        arr.Append(node->data);
-        storeInOrder(node->right, arr);
+        inOrderNodes(node, [&arr](Node<T>* current) { arr.Append(current->data); });
     }
     
     Node<T>* buildBalancedTree(const MutableArraySequence<T>& arr, int start, int end)
@@ -131,6 +332,7 @@ private:
         
         node->left = buildBalancedTree(arr, start, mid - 1);
         node->right = buildBalancedTree(arr, mid + 1, end);
+        updateNode(node);
         
         return node;
     }
@@ -175,26 +377,17 @@ private:
     
     void serializePreOrder(Node<T>* node, DynamicArray<char>& buffer) const
     {
-        if (node == nullptr) return;
-        valueToString(node->data, buffer);
-        serializePreOrder(node->left, buffer);
-        serializePreOrder(node->right, buffer);
+        preOrderNodes(node, [&](Node<T>* current) { valueToString(current->data, buffer); });
     }
     
     void serializeInOrder(Node<T>* node, DynamicArray<char>& buffer) const
     {
-        if (node == nullptr) return;
-        serializeInOrder(node->left, buffer);
-        valueToString(node->data, buffer);
-        serializeInOrder(node->right, buffer);
+        inOrderNodes(node, [&](Node<T>* current) { valueToString(current->data, buffer); });
     }
     
     void serializePostOrder(Node<T>* node, DynamicArray<char>& buffer) const
     {
-        if (node == nullptr) return;
-        serializePostOrder(node->left, buffer);
-        serializePostOrder(node->right, buffer);
-        valueToString(node->data, buffer);
+        postOrderNodes(node, [&](Node<T>* current) { valueToString(current->data, buffer); });
     }
     
     bool compareFormats(const DynamicArray<char>& format1, const DynamicArray<char>& format2) const
@@ -210,20 +403,17 @@ private:
     class TreeIterator : public IIterator<T> 
     {
     private:
-        const BinaryTree<T>* tree;
+        const BinaryTree* tree;
         MutableArraySequence<T> elements;
         int currentIndex;
 
         void collectElements(Node<T>* node) 
         {
-            if (node == nullptr) return;
-            collectElements(node->left);
-            elements.Append(node->data);
-            collectElements(node->right);
+            inOrderNodes(node, [this](Node<T>* current) { elements.Append(current->data); });
         }
 
     public:
-        TreeIterator(const BinaryTree<T>* bt) : tree(bt), currentIndex(0) 
+        TreeIterator(const BinaryTree* bt) : tree(bt), currentIndex(0) 
         {
             collectElements(tree->root);
         }
@@ -281,17 +471,32 @@ public:
 
     void insert(const T& value) 
     {
-        root = insertRecursive(root, value);
+        bool inserted = false;
+        insertNode(value, inserted);
+    }
+
+    // Вставляет значение, если равного ему ещё нет, и возвращает узел с этим значением.
+    // Повороты AVL и удаление других элементов перевешивают узлы, не перемещая данные,
+    // поэтому указатель остаётся действительным до удаления самого элемента
+    Node<T>* insertOrFind(const T& value, bool& inserted) 
+    {
+        return insertNode(value, inserted);
     }
     
     void remove(const T& value) 
     {
-        root = removeRecursive(root, value);
+        removeNode(value);
     }
     
     bool contains(const T& value) const 
     {
-        return containsRecursive(root, value);
+        Node<T>* current = root;
+        while (current != nullptr) 
+        {
+            if (current->data == value) return true;
+            current = value < current->data ? current->left : current->right;
+        }
+        return false;
     }
     
     bool isEmpty() const 
@@ -301,7 +506,7 @@ public:
     
     void clear() 
     {
-        clearRecursive(root);
+        clearNodes(root);
         root = nullptr;
     }
     
@@ -310,6 +515,64 @@ public:
         return root; 
     }
 
+    int getHeight() const 
+    {
+        return heightOf(root);
+    }
+
+    // Число элементов за O(1)
+    int getCount() const 
+    {
+        return sizeOf(root);
+    }
+
+    // k-й по возрастанию элемент (с нуля) за O(высоты)
+    const T& select(int k) const 
+    {
+        if (k < 0 || k >= sizeOf(root)) 
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        Node<T>* current = root;
+        while (true) 
+        {
+            int leftSize = sizeOf(current->left);
+            if (k < leftSize) 
+            {
+                current = current->left;
+            }
+            else if (k == leftSize) 
+            {
+                return current->data;
+            }
+            else 
+            {
+                k -= leftSize + 1;
+                current = current->right;
+            }
+        }
+    }
+
+    // Количество элементов, строго меньших value, за O(высоты)
+    int rank(const T& value) const 
+    {
+        int result = 0;
+        Node<T>* current = root;
+        while (current != nullptr) 
+        {
+            if (current->data < value) 
+            {
+                result += sizeOf(current->left) + 1;
+                current = current->right;
+            }
+            else 
+            {
+                current = current->left;
+            }
+        }
+        return result;
+    }
+
     void balance() 
     {
         if (root == nullptr) return;
@@ -325,57 +588,25 @@ public:
     template <typename Func>
     void traversePreOrder(Func func) const 
     {
-        struct TraversalHelper 
-        {
-            static void preOrder(Node<T>* node, Func func) 
-            {
-                if (node == nullptr) return;
-                func(node->data);
-                preOrder(node->left, func);
-                preOrder(node->right, func);
-            }
-        };
-        
-        TraversalHelper::preOrder(root, func);
+        preOrderNodes(root, [&func](Node<T>* node) { func(node->data); });
     }
     
     template <typename Func>
     void traverseInOrder(Func func) const 
     {
-        struct TraversalHelper 
-        {
-            static void inOrder(Node<T>* node, Func func) 
-            {
-                if (node == nullptr) return;
-                inOrder(node->left, func);
-                func(node->data);
-                inOrder(node->right, func);
-            }
-        };
-        
-        TraversalHelper::inOrder(root, func);
+        inOrderNodes(root, [&func](Node<T>* node) { func(node->data); });
     }
     
     template <typename Func>
     void traversePostOrder(Func func) const 
     {
-        struct TraversalHelper {
-            static void postOrder(Node<T>* node, Func func) 
-            {
-                if (node == nullptr) return;
-                postOrder(node->left, func);
-                postOrder(node->right, func);
-                func(node->data);
-            }
-        };
-        
-        TraversalHelper::postOrder(root, func);
+        postOrderNodes(root, [&func](Node<T>* node) { func(node->data); });
     }
 
     // Функциональные операции
-    BinaryTree<T> map(std::function<T(T)> func) const
+    BinaryTree map(std::function<T(T)> func) const 
     {
-        BinaryTree<T> result;
+        BinaryTree result;
         traversePreOrder([&result, &func](const T& value) 
         {
             result.insert(func(value));
@@ -383,9 +614,9 @@ public:
         return result;
     }
     
-    BinaryTree<T> where(std::function<bool(T)> predicate) const 
+    BinaryTree where(std::function<bool(T)> predicate) const 
     {
-        BinaryTree<T> result;
+        BinaryTree result;
         traversePreOrder([&result, &predicate](const T& value) 
         {
             if (predicate(value)) 
@@ -407,7 +638,7 @@ public:
         return result;
     }
 
-    void merge(const BinaryTree<T>& other) 
+    void merge(const BinaryTree& other) 
     {
         other.traversePreOrder([this](const T& value) 
         {
@@ -415,9 +646,9 @@ public:
         });
     }
     
-    BinaryTree<T> extractSubtree(const T& value) const 
+    BinaryTree extractSubtree(const T& value) const 
     {
-        BinaryTree<T> result;
+        BinaryTree result;
         Node<T>* node = findNode(value);
         if (node != nullptr) 
         {
@@ -426,7 +657,7 @@ public:
         return result;
     }
     
-    bool containsSubtree(const BinaryTree<T>& subtree) const 
+    bool containsSubtree(const BinaryTree& subtree) const 
     {
         if (subtree.root == nullptr) return true;
         
@@ -546,4 +777,8 @@ public:
     }
 };
 
+// Самобалансирующееся дерево поиска, на котором построены Set, Dictionary и другие контейнеры
+template <typename T>
+using AVLTree = BinaryTree<T, true>;
+
 #endif
@@ -0,0 +1,178 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include "DynamicArray.h"
+#include <stdexcept>
+#include <utility>
+
+// Двусторонняя очередь на кольцевом буфере.
+// Добавление и извлечение с обоих концов - O(1) (амортизированно при росте),
+// элементы лежат в одном массиве, ёмкость - степень двойки.
+template <typename T>
+class Deque 
+{
+private:
+    DynamicArray<T> buffer;
+    int head;    // индекс первого элемента
+    int count;
+
+    int mask() const 
+    {
+        return buffer.GetSize() - 1;
+    }
+
+    int physicalIndex(int index) const 
+    {
+        return (head + index) & mask();
+    }
+
+    void grow(int required) 
+    {
+        int newCapacity = buffer.GetSize() < 8 ? 8 : buffer.GetSize();
+        while (newCapacity < required) 
+        {
+            newCapacity *= 2;
+        }
+        if (newCapacity == buffer.GetSize()) return;
+
+        DynamicArray<T> newBuffer(newCapacity);
+        for (int i = 0; i < count; i++) 
+        {
+            newBuffer[i] = std::move(buffer[physicalIndex(i)]);
+        }
+        buffer = std::move(newBuffer);
+        head = 0;
+    }
+
+public:
+    Deque() : head(0), count(0) {}
+
+    explicit Deque(int capacity) : head(0), count(0) 
+    {
+        Reserve(capacity);
+    }
+
+    void Reserve(int capacity) 
+    {
+        if (capacity > buffer.GetSize()) 
+        {
+            grow(capacity);
+        }
+    }
+
+    void PushBack(const T& value) 
+    {
+        if (count == buffer.GetSize()) 
+        {
+            // value может ссылаться на элемент этой же очереди
+            T copy = value;
+            grow(count + 1);
+            buffer[physicalIndex(count)] = std::move(copy);
+            count++;
+            return;
+        }
+        buffer[physicalIndex(count)] = value;
+        count++;
+    }
+
+    void PushBack(T&& value) 
+    {
+        if (count == buffer.GetSize()) 
+        {
+            T moved = std::move(value);
+            grow(count + 1);
+            buffer[physicalIndex(count)] = std::move(moved);
+            count++;
+            return;
+        }
+        buffer[physicalIndex(count)] = std::move(value);
+        count++;
+    }
+
+    void PushFront(const T& value) 
+    {
+        if (count == buffer.GetSize()) 
+        {
+            // value может ссылаться на элемент этой же очереди
+            T copy = value;
+            grow(count + 1);
+            head = (head - 1) & mask();
+            buffer[head] = std::move(copy);
+            count++;
+            return;
+        }
+        head = (head - 1) & mask();
+        buffer[head] = value;
+        count++;
+    }
+
+    void PushFront(T&& value) 
+    {
+        if (count == buffer.GetSize()) 
+        {
+            T moved = std::move(value);
+            grow(count + 1);
+            head = (head - 1) & mask();
+            buffer[head] = std::move(moved);
+            count++;
+            return;
+        }
+        head = (head - 1) & mask();
+        buffer[head] = std::move(value);
+        count++;
+    }
+
+    T PopFront() 
+    {
+        if (count == 0) throw std::runtime_error("Deque is empty");
+        T value = std::move(buffer[head]);
+        head = (head + 1) & mask();
+        count--;
+        return value;
+    }
+
+    T PopBack() 
+    {
+        if (count == 0) throw std::runtime_error("Deque is empty");
+        count--;
+        return std::move(buffer[physicalIndex(count)]);
+    }
+
+    const T& Front() const 
+    {
+        if (count == 0) throw std::runtime_error("Deque is empty");
+        return buffer[head];
+    }
+
+    const T& Back() const 
+    {
+        if (count == 0) throw std::runtime_error("Deque is empty");
+        return buffer[physicalIndex(count - 1)];
+    }
+
+    // Элемент по индексу от начала очереди
+    const T& Get(int index) const 
+    {
+        if (index < 0 || index >= count) throw std::out_of_range("Index out of range");
+        return buffer[physicalIndex(index)];
+    }
+
+    bool IsEmpty() const 
+    {
+        return count == 0;
+    }
+
+    int GetCount() const 
+    {
+        return count;
+    }
+
+    // Очищает очередь, сохраняя выделенную память
+    void Clear() 
+    {
+        head = 0;
+        count = 0;
+    }
+};
+
+#endif
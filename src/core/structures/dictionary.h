@@ -2,9 +2,11 @@
 #define DICTIONARY_H
 
 #include "binary_tree.h"
+#include "hash_table.h"
 #include <functional>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 // Структура для сравнения пар по ключу
 template<typename TKey, typename TValue>
@@ -85,24 +87,68 @@ public:
     }
 };
 
-template <typename TKey, typename TValue>
+// TStorage выбирает хранилище: TreeStorage (AVL-дерево, обход по возрастанию ключей)
+// или HashStorage (хеш-таблица с открытой адресацией, порядок обхода не определён)
+template <typename TKey, typename TValue, typename TStorage = TreeStorage>
 class Dictionary 
 {
 private:
-    BinaryTree<DictionaryPair<TKey, TValue>> tree;
+    AVLTree<DictionaryPair<TKey, TValue>> tree;
 
 public:
     Dictionary() = default;
 
     void Add(TKey key, TValue value) 
     {
-        DictionaryPair<TKey, TValue> pair(key, value);
+        Upsert(key, value);
+    }
+
+    // Вставляет пару или перезаписывает значение на месте за один проход по дереву.
+    // Возвращает true, если ключ был добавлен
+    bool Upsert(const TKey& key, const TValue& value) 
+    {
+        bool inserted = false;
+        auto node = tree.insertOrFind(DictionaryPair<TKey, TValue>(key, value), inserted);
+        if (!inserted) 
+        {
+            node->data.getValue() = value;
+        }
+        return inserted;
+    }
+
+    // Указатель на значение по ключу или nullptr; значение можно менять на месте
+    TValue* TryGet(const TKey& key) 
+    {
         DictionaryPair<TKey, TValue> searchPair(key, TValue());
-        if (tree.contains(searchPair)) 
+        auto node = tree.findNode(searchPair);
+        return node != nullptr ? &node->data.getValue() : nullptr;
+    }
+
+    const TValue* TryGet(const TKey& key) const 
+    {
+        DictionaryPair<TKey, TValue> searchPair(key, TValue());
+        auto node = tree.findNode(searchPair);
+        return node != nullptr ? &node->data.getValue() : nullptr;
+    }
+
+    // Ссылка на значение по ключу; отсутствующий ключ добавляется со значением TValue()
+    TValue& GetOrInsert(const TKey& key) 
+    {
+        bool inserted = false;
+        auto node = tree.insertOrFind(DictionaryPair<TKey, TValue>(key, TValue()), inserted);
+        return node->data.getValue();
+    }
+
+    // Создаёт значение из args, только если ключа ещё нет. Возвращает true, если ключ был добавлен
+    template<typename... Args>
+    bool Emplace(const TKey& key, Args&&... args) 
+    {
+        if (TryGet(key) != nullptr) 
         {
-            tree.remove(searchPair);
+            return false;
         }
-        tree.insert(pair);
+        tree.insert(DictionaryPair<TKey, TValue>(key, TValue(std::forward<Args>(args)...)));
+        return true;
     }
 
     bool ContainsKey(TKey key) const 
@@ -129,12 +175,7 @@ public:
 
     int GetCount() const 
     {
-        int count = 0;
-        tree.traverseInOrder([&count](const DictionaryPair<TKey, TValue>& pair) 
-        {
-            count++;
-        });
-        return count;
+        return tree.getCount();
     }
 
     bool IsEmpty() const 
@@ -147,6 +188,9 @@ public:
         tree.clear();
     }
 
+    // Дереву нечего резервировать; метод есть для совместимости с хеш-хранилищем
+    void Reserve(int) {}
+
     // Для получения всех ключей
     template<typename Func>
     void ForEachKey(Func func) const 
@@ -220,4 +264,154 @@ public:
     }
 };
 
+template <typename TKey, typename TValue>
+class Dictionary<TKey, TValue, HashStorage> 
+{
+private:
+    HashTable<TKey, TValue> table;
+
+public:
+    Dictionary() = default;
+
+    void Add(TKey key, TValue value) 
+    {
+        table.insertOrAssign(key, value);
+    }
+
+    bool Upsert(const TKey& key, const TValue& value) 
+    {
+        return table.insertOrAssign(key, value);
+    }
+
+    TValue* TryGet(const TKey& key) 
+    {
+        return table.find(key);
+    }
+
+    const TValue* TryGet(const TKey& key) const 
+    {
+        return table.find(key);
+    }
+
+    TValue& GetOrInsert(const TKey& key) 
+    {
+        bool inserted = false;
+        return table.findOrInsert(key, TValue(), inserted);
+    }
+
+    template<typename... Args>
+    bool Emplace(const TKey& key, Args&&... args) 
+    {
+        if (table.contains(key)) 
+        {
+            return false;
+        }
+        bool inserted = false;
+        table.findOrInsert(key, TValue(std::forward<Args>(args)...), inserted);
+        return true;
+    }
+
+    bool ContainsKey(TKey key) const 
+    {
+        return table.contains(key);
+    }
+
+    TValue Get(TKey key) const 
+    {
+        const TValue* value = table.find(key);
+        if (value != nullptr) 
+        {
+            return *value;
+        }
+        throw std::runtime_error("Key not found");
+    }
+
+    void Remove(TKey key) 
+    {
+        table.remove(key);
+    }
+
+    int GetCount() const 
+    {
+        return table.getCount();
+    }
+
+    bool IsEmpty() const 
+    {
+        return table.isEmpty();
+    }
+
+    void Clear() 
+    {
+        table.clear();
+    }
+
+    void Reserve(int count) 
+    {
+        table.reserve(count);
+    }
+
+    template<typename Func>
+    void ForEachKey(Func func) const 
+    {
+        table.forEach([&func](const TKey& key, const TValue&) 
+        {
+            func(key);
+        });
+    }
+
+    template<typename Func>
+    void ForEachValue(Func func) const 
+    {
+        table.forEach([&func](const TKey&, const TValue& value) 
+        {
+            func(value);
+        });
+    }
+
+    template<typename Func>
+    void ForEach(Func func) const 
+    {
+        table.forEach(func);
+    }
+
+    Sequence<TKey>* GetKeys() const 
+    {
+        auto keys = new MutableArraySequence<TKey>();
+        ForEachKey([keys](const TKey& key) 
+        {
+            keys->Append(key);
+        });
+        return keys;
+    }
+
+    Sequence<TValue>* GetValues() const 
+    {
+        auto values = new MutableArraySequence<TValue>();
+        ForEachValue([values](const TValue& value) 
+        {
+            values->Append(value);
+        });
+        return values;
+    }
+
+    bool ContainsValue(TValue value) const 
+    {
+        bool found = false;
+        ForEachValue([&found, &value](const TValue& val) 
+        {
+            if (val == value) 
+            {
+                found = true;
+            }
+        });
+        return found;
+    }
+
+    // Хеш-таблица не требует балансировки, метод оставлен для совместимости интерфейса
+    void Balance() 
+    {
+    }
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,120 @@
+#ifndef DISJOINT_SET_H
+#define DISJOINT_SET_H
+
+#include "DynamicArray.h"
+#include <stdexcept>
+#include <utility>
+
+// Система непересекающихся множеств (union-find) над плотными номерами 0..n-1.
+// Объединение по размеру и сжатие путей дают почти O(1) амортизированно на операцию
+// (обратная функция Аккермана). Число множеств и размер каждого поддерживаются
+// при объединении, поэтому запросы не требуют обхода.
+class DisjointSet 
+{
+private:
+    DynamicArray<int> parent;
+    DynamicArray<int> size;    // размер множества, актуален только для корней
+    int setCount;
+
+    void checkElement(int element) const 
+    {
+        if (element < 0 || element >= parent.GetSize()) 
+        {
+            throw std::out_of_range("Element index out of range");
+        }
+    }
+
+public:
+    DisjointSet() : setCount(0) {}
+
+    // n одноэлементных множеств
+    explicit DisjointSet(int n) : setCount(0) 
+    {
+        Reserve(n);
+        for (int i = 0; i < n; i++) 
+        {
+            AddElement();
+        }
+    }
+
+    void Reserve(int capacity) 
+    {
+        parent.Reserve(capacity);
+        size.Reserve(capacity);
+    }
+
+    // Новое одноэлементное множество; возвращает номер элемента
+    int AddElement() 
+    {
+        int element = parent.GetSize();
+        parent.PushBack(element);
+        size.PushBack(1);
+        setCount++;
+        return element;
+    }
+
+    // Представитель множества элемента. Два прохода: поиск корня, затем
+    // перенаправление всех вершин пути прямо на корень
+    int Find(int element) 
+    {
+        checkElement(element);
+        int root = element;
+        while (parent[root] != root) 
+        {
+            root = parent[root];
+        }
+        while (parent[element] != root) 
+        {
+            int next = parent[element];
+            parent[element] = root;
+            element = next;
+        }
+        return root;
+    }
+
+    // Объединяет множества элементов; false, если они уже были в одном множестве.
+    // Меньшее множество подвешивается к большему, поэтому глубина деревьев - O(log n)
+    bool Union(int first, int second) 
+    {
+        int a = Find(first);
+        int b = Find(second);
+        if (a == b) return false;
+        if (size[a] < size[b]) 
+        {
+            std::swap(a, b);
+        }
+        parent[b] = a;
+        size[a] += size[b];
+        setCount--;
+        return true;
+    }
+
+    bool AreConnected(int first, int second) 
+    {
+        return Find(first) == Find(second);
+    }
+
+    int GetSetSize(int element) 
+    {
+        return size[Find(element)];
+    }
+
+    int GetSetCount() const 
+    {
+        return setCount;
+    }
+
+    int GetElementCount() const 
+    {
+        return parent.GetSize();
+    }
+
+    void Clear() 
+    {
+        parent.Clear();
+        size.Clear();
+        setCount = 0;
+    }
+};
+
+#endif
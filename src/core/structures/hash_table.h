@@ -0,0 +1,346 @@
+#ifndef HASH_TABLE_H
+#define HASH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Теги выбора хранилища для Set и Dictionary
+struct TreeStorage {};
+struct HashStorage {};
+
+// Есть ли для T пригодная std::hash
+template <typename T, typename = void>
+struct IsHashable : std::false_type {};
+
+template <typename T>
+struct IsHashable<T, std::void_t<decltype(std::hash<T>()(std::declval<const T&>()))>> : std::true_type {};
+
+// Хранилище для служебных индексов алгоритмов: хеш-таблица, если у T есть std::hash,
+// иначе AVL-дерево (достаточно operator<)
+template <typename T>
+using IndexStorage = typename std::conditional<IsHashable<T>::value, HashStorage, TreeStorage>::type;
+
+// Хеш-функция для ключей таблицы. std::hash для целых чисел часто тождественна,
+// поэтому результат дополнительно перемешивается (финализатор MurmurHash3)
+template <typename T>
+struct HashFunction 
+{
+    static size_t hash(const T& value) 
+    {
+        uint64_t x = static_cast<uint64_t>(std::hash<T>()(value));
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return static_cast<size_t>(x);
+    }
+};
+
+// Хеш-таблица с открытой адресацией по схеме Robin Hood.
+// Ключи и значения лежат в одном непрерывном массиве, поиск идёт линейным
+// пробированием и прекращается, как только расстояние пробы текущего элемента
+// становится меньше искомого. Удаление выполняется обратным сдвигом без "надгробий".
+template <typename TKey, typename TValue>
+class HashTable 
+{
+private:
+    struct Slot 
+    {
+        TKey key;
+        TValue value;
+    };
+
+    Slot* slots;
+    int* probes;     // 0 - ячейка пуста, иначе расстояние от идеальной позиции + 1
+    int capacity;    // всегда степень двойки
+    int count;
+
+    static const int MIN_CAPACITY = 8;
+
+    int idealIndex(const TKey& key) const 
+    {
+        return static_cast<int>(HashFunction<TKey>::hash(key) & static_cast<size_t>(capacity - 1));
+    }
+
+    int findIndex(const TKey& key) const 
+    {
+        if (count == 0) return -1;
+
+        int mask = capacity - 1;
+        int index = idealIndex(key);
+        int distance = 1;
+        while (probes[index] != 0 && probes[index] >= distance) 
+        {
+            if (probes[index] == distance && slots[index].key == key) 
+            {
+                return index;
+            }
+            index = (index + 1) & mask;
+            distance++;
+        }
+        return -1;
+    }
+
+    // Размещает отсутствующий в таблице ключ и возвращает индекс его ячейки
+    int placeNew(TKey key, TValue value) 
+    {
+        int mask = capacity - 1;
+        int index = idealIndex(key);
+        int distance = 1;
+        int placedIndex = -1;
+
+        while (true) 
+        {
+            if (probes[index] == 0) 
+            {
+                slots[index].key = std::move(key);
+                slots[index].value = std::move(value);
+                probes[index] = distance;
+                count++;
+                return placedIndex == -1 ? index : placedIndex;
+            }
+
+            if (probes[index] < distance) 
+            {
+                std::swap(slots[index].key, key);
+                std::swap(slots[index].value, value);
+                std::swap(probes[index], distance);
+                if (placedIndex == -1) 
+                {
+                    placedIndex = index;
+                }
+            }
+
+            index = (index + 1) & mask;
+            distance++;
+        }
+    }
+
+    void rehash(int newCapacity) 
+    {
+        Slot* oldSlots = slots;
+        int* oldProbes = probes;
+        int oldCapacity = capacity;
+
+        slots = new Slot[newCapacity];
+        probes = new int[newCapacity]();
+        capacity = newCapacity;
+        count = 0;
+
+        for (int i = 0; i < oldCapacity; i++) 
+        {
+            if (oldProbes[i] != 0) 
+            {
+                placeNew(std::move(oldSlots[i].key), std::move(oldSlots[i].value));
+            }
+        }
+
+        delete[] oldSlots;
+        delete[] oldProbes;
+    }
+
+    // Заполнение не превышает 7/8 ёмкости
+    void growIfNeeded() 
+    {
+        if (capacity == 0) 
+        {
+            rehash(MIN_CAPACITY);
+        }
+        else if ((count + 1) * 8 > capacity * 7) 
+        {
+            rehash(capacity * 2);
+        }
+    }
+
+    void copyFrom(const HashTable& other) 
+    {
+        capacity = other.capacity;
+        count = other.count;
+        if (capacity == 0) 
+        {
+            slots = nullptr;
+            probes = nullptr;
+            return;
+        }
+        slots = new Slot[capacity];
+        probes = new int[capacity];
+        for (int i = 0; i < capacity; i++) 
+        {
+            probes[i] = other.probes[i];
+            if (probes[i] != 0) 
+            {
+                slots[i] = other.slots[i];
+            }
+        }
+    }
+
+public:
+    HashTable() : slots(nullptr), probes(nullptr), capacity(0), count(0) {}
+
+    HashTable(const HashTable& other) 
+    {
+        copyFrom(other);
+    }
+
+    HashTable(HashTable&& other) noexcept : slots(other.slots), probes(other.probes), capacity(other.capacity), count(other.count) 
+    {
+        other.slots = nullptr;
+        other.probes = nullptr;
+        other.capacity = 0;
+        other.count = 0;
+    }
+
+    HashTable& operator=(const HashTable& other) 
+    {
+        if (this != &other) 
+        {
+            delete[] slots;
+            delete[] probes;
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    HashTable& operator=(HashTable&& other) noexcept 
+    {
+        if (this != &other) 
+        {
+            delete[] slots;
+            delete[] probes;
+            slots = other.slots;
+            probes = other.probes;
+            capacity = other.capacity;
+            count = other.count;
+            other.slots = nullptr;
+            other.probes = nullptr;
+            other.capacity = 0;
+            other.count = 0;
+        }
+        return *this;
+    }
+
+    ~HashTable() 
+    {
+        delete[] slots;
+        delete[] probes;
+    }
+
+    TValue* find(const TKey& key) 
+    {
+        int index = findIndex(key);
+        return index == -1 ? nullptr : &slots[index].value;
+    }
+
+    const TValue* find(const TKey& key) const 
+    {
+        int index = findIndex(key);
+        return index == -1 ? nullptr : &slots[index].value;
+    }
+
+    bool contains(const TKey& key) const 
+    {
+        return findIndex(key) != -1;
+    }
+
+    // Возвращает значение по ключу, вставляя value, если ключа ещё нет
+    TValue& findOrInsert(const TKey& key, const TValue& value, bool& inserted) 
+    {
+        int index = findIndex(key);
+        if (index != -1) 
+        {
+            inserted = false;
+            return slots[index].value;
+        }
+        growIfNeeded();
+        inserted = true;
+        return slots[placeNew(key, value)].value;
+    }
+
+    // Вставляет пару или перезаписывает значение; возвращает true, если ключ новый
+    bool insertOrAssign(const TKey& key, const TValue& value) 
+    {
+        int index = findIndex(key);
+        if (index != -1) 
+        {
+            slots[index].value = value;
+            return false;
+        }
+        growIfNeeded();
+        placeNew(key, value);
+        return true;
+    }
+
+    bool remove(const TKey& key) 
+    {
+        int index = findIndex(key);
+        if (index == -1) return false;
+
+        int mask = capacity - 1;
+        int next = (index + 1) & mask;
+        while (probes[next] > 1) 
+        {
+            slots[index] = std::move(slots[next]);
+            probes[index] = probes[next] - 1;
+            index = next;
+            next = (next + 1) & mask;
+        }
+        slots[index] = Slot();
+        probes[index] = 0;
+        count--;
+        return true;
+    }
+
+    // Резервирует место под expectedCount элементов без перехеширования
+    void reserve(int expectedCount) 
+    {
+        int needed = MIN_CAPACITY;
+        while (needed * 7 < expectedCount * 8) 
+        {
+            needed *= 2;
+        }
+        if (needed > capacity) 
+        {
+            rehash(needed);
+        }
+    }
+
+    int getCount() const 
+    {
+        return count;
+    }
+
+    bool isEmpty() const 
+    {
+        return count == 0;
+    }
+
+    void clear() 
+    {
+        delete[] slots;
+        delete[] probes;
+        slots = nullptr;
+        probes = nullptr;
+        capacity = 0;
+        count = 0;
+    }
+
+    // Обход в порядке ячеек таблицы (порядок ключей не определён)
+    template <typename Func>
+    void forEach(Func func) const 
+    {
+        for (int i = 0; i < capacity; i++) 
+        {
+            if (probes[i] != 0) 
+            {
+                func(slots[i].key, slots[i].value);
+            }
+        }
+    }
+};
+
+#endif
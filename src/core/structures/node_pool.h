@@ -0,0 +1,141 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <new>
+#include <utility>
+
+// Теги выбора способа размещения узлов связных структур
+struct HeapNodeAllocator {};     // каждый узел - отдельный new/delete
+struct PooledNodeAllocator {};   // узлы берутся из пула блоками и возвращаются в список свободных
+
+// Пул узлов одного типа: память выделяется блоками по NODES_PER_CHUNK узлов,
+// освобождённые узлы попадают в односвязный список свободных и переиспользуются.
+// Пул свой у каждого потока, поэтому узлы нельзя передавать между потоками
+// (список, созданный в одном потоке, должен и уничтожаться в нём же).
+template <class Node>
+class NodePool 
+{
+private:
+    static const int NODES_PER_CHUNK = 256;
+
+    union Slot 
+    {
+        Slot* next;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    struct Chunk 
+    {
+        Chunk* next;
+        Slot slots[NODES_PER_CHUNK];
+    };
+
+    Chunk* chunks;
+    Slot* freeList;
+    long live;    // число выданных и ещё не возвращённых узлов
+
+    void addChunk() 
+    {
+        Chunk* chunk = new Chunk;
+        chunk->next = chunks;
+        chunks = chunk;
+        for (int i = NODES_PER_CHUNK - 1; i >= 0; i--) 
+        {
+            chunk->slots[i].next = freeList;
+            freeList = &chunk->slots[i];
+        }
+    }
+
+    NodePool() : chunks(nullptr), freeList(nullptr), live(0) {}
+
+public:
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    ~NodePool() 
+    {
+        // Если какие-то узлы ещё живы, память блоков оставляем им
+        if (live != 0) return;
+        while (chunks) 
+        {
+            Chunk* next = chunks->next;
+            delete chunks;
+            chunks = next;
+        }
+    }
+
+    static NodePool& Instance() 
+    {
+        thread_local NodePool pool;
+        return pool;
+    }
+
+    void* Allocate() 
+    {
+        if (!freeList) 
+        {
+            addChunk();
+        }
+        Slot* slot = freeList;
+        freeList = slot->next;
+        live++;
+        return slot;
+    }
+
+    void Release(void* memory) 
+    {
+        Slot* slot = static_cast<Slot*>(memory);
+        slot->next = freeList;
+        freeList = slot;
+        live--;
+    }
+};
+
+// Создание и уничтожение узлов в зависимости от выбранного тега
+template <class TAllocator>
+struct NodeAllocation;
+
+template <>
+struct NodeAllocation<HeapNodeAllocator> 
+{
+    template <class Node, class... Args>
+    static Node* Create(Args&&... args) 
+    {
+        return new Node(std::forward<Args>(args)...);
+    }
+
+    template <class Node>
+    static void Destroy(Node* node) 
+    {
+        delete node;
+    }
+};
+
+template <>
+struct NodeAllocation<PooledNodeAllocator> 
+{
+    template <class Node, class... Args>
+    static Node* Create(Args&&... args) 
+    {
+        NodePool<Node>& pool = NodePool<Node>::Instance();
+        void* memory = pool.Allocate();
+        try 
+        {
+            return new (memory) Node(std::forward<Args>(args)...);
+        }
+        catch (...) 
+        {
+            pool.Release(memory);
+            throw;
+        }
+    }
+
+    template <class Node>
+    static void Destroy(Node* node) 
+    {
+        node->~Node();
+        NodePool<Node>::Instance().Release(node);
+    }
+};
+
+#endif
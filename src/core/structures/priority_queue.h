@@ -1,86 +1,321 @@
 #ifndef PRIORITY_QUEUE_H
 #define PRIORITY_QUEUE_H
 
-#include "binary_tree.h"
+#include "DynamicArray.h"
 #include <functional>
+#include <stdexcept>
+#include <utility>
 
-template <typename T>
+// Очередь с приоритетами на d-арной куче в массиве.
+// Первым извлекается элемент, для которого comparator(элемент, другой) ложно для всех
+// остальных (с std::less - наибольший), как в std::priority_queue.
+// Равные по приоритету элементы хранятся все, извлечение и вставка - O(log n),
+// память растёт удвоением, поэтому вставка не выделяет память на каждый элемент.
+template <typename T, int Arity = 4>
 class PriorityQueue 
 {
+    static_assert(Arity >= 2, "Heap arity must be at least 2");
+
 private:
-    BinaryTree<T> tree;
+    DynamicArray<T> items;
+    int count;
     std::function<bool(const T&, const T&)> comparator;
 
+    void siftUp(int index) 
+    {
+        T value = std::move(items[index]);
+        while (index > 0) 
+        {
+            int parent = (index - 1) / Arity;
+            if (!comparator(items[parent], value)) break;
+            items[index] = std::move(items[parent]);
+            index = parent;
+        }
+        items[index] = std::move(value);
+    }
+
+    void siftDown(int index) 
+    {
+        T value = std::move(items[index]);
+        while (true) 
+        {
+            int firstChild = index * Arity + 1;
+            if (firstChild >= count) break;
+
+            int lastChild = firstChild + Arity < count ? firstChild + Arity : count;
+            int best = firstChild;
+            for (int child = firstChild + 1; child < lastChild; child++) 
+            {
+                if (comparator(items[best], items[child])) 
+                {
+                    best = child;
+                }
+            }
+
+            if (!comparator(value, items[best])) break;
+            items[index] = std::move(items[best]);
+            index = best;
+        }
+        items[index] = std::move(value);
+    }
+
 public:
-    PriorityQueue(std::function<bool(const T&, const T&)> comp = std::less<T>()) : comparator(comp) {}
+    PriorityQueue(std::function<bool(const T&, const T&)> comp = std::less<T>()) : count(0), comparator(comp) {}
 
     void Enqueue(const T& value) 
     {
-        tree.insert(value);
+        if (count == items.GetSize()) 
+        {
+            items.Resize(count == 0 ? 16 : count * 2);
+        }
+        items[count] = value;
+        count++;
+        siftUp(count - 1);
     }
 
     T Dequeue() {
-        if (tree.isEmpty()) 
+        if (count == 0) 
         {
             throw std::runtime_error("Priority queue is empty");
         }
 
-        T result;
-        bool first = true;
-        
-        tree.traverseInOrder([&](const T& value) 
+        T result = std::move(items[0]);
+        count--;
+        if (count > 0) 
         {
-            if (first || comparator(result, value)) 
-            {
-                result = value;
-                first = false;
-            }
-        });
-
-        tree.remove(result);
+            items[0] = std::move(items[count]);
+            siftDown(0);
+        }
         return result;
     }
 
     T Peek() const {
-        if (tree.isEmpty()) 
+        if (count == 0) 
         {
             throw std::runtime_error("Priority queue is empty");
         }
+        return items[0];
+    }
+
+    bool IsEmpty() const 
+    {
+        return count == 0;
+    }
+
+    int GetCount() const 
+    {
+        return count;
+    }
+
+    void Clear() 
+    {
+        items = DynamicArray<T>();
+        count = 0;
+    }
+};
+
+// Индексированная min-куча над плотными дескрипторами 0..capacity-1.
+// Каждому дескриптору (например, номеру вершины) соответствует не более одного элемента,
+// поэтому приоритет уже находящегося в куче элемента можно уменьшить за O(log n) через DecreaseKey.
+template <typename TPriority = double, int Arity = 4>
+class IndexedPriorityQueue 
+{
+    static_assert(Arity >= 2, "Heap arity must be at least 2");
+
+private:
+    DynamicArray<int> heap;             // дескрипторы в порядке кучи
+    DynamicArray<int> positions;        // позиция дескриптора в куче или -1
+    DynamicArray<TPriority> priorities; // приоритет по дескриптору
+    int count;
+
+    void place(int index, int handle) 
+    {
+        heap[index] = handle;
+        positions[handle] = index;
+    }
+
+    void siftUp(int index) 
+    {
+        int handle = heap[index];
+        TPriority priority = priorities[handle];
+        while (index > 0) 
+        {
+            int parent = (index - 1) / Arity;
+            if (!(priority < priorities[heap[parent]])) break;
+            place(index, heap[parent]);
+            index = parent;
+        }
+        place(index, handle);
+    }
 
-        T result;
-        bool first = true;
-        
-        tree.traverseInOrder([&](const T& value) 
+    void siftDown(int index) 
+    {
+        int handle = heap[index];
+        TPriority priority = priorities[handle];
+        while (true) 
         {
-            if (first || comparator(result, value)) 
+            int firstChild = index * Arity + 1;
+            if (firstChild >= count) break;
+
+            int lastChild = firstChild + Arity < count ? firstChild + Arity : count;
+            int best = firstChild;
+            for (int child = firstChild + 1; child < lastChild; child++) 
             {
-                result = value;
-                first = false;
+                if (priorities[heap[child]] < priorities[heap[best]]) 
+                {
+                    best = child;
+                }
             }
-        });
 
-        return result;
+            if (!(priorities[heap[best]] < priority)) break;
+            place(index, heap[best]);
+            index = best;
+        }
+        place(index, handle);
+    }
+
+    void checkHandle(int handle) const 
+    {
+        if (handle < 0 || handle >= positions.GetSize()) 
+        {
+            throw std::out_of_range("Heap handle is out of range");
+        }
+    }
+
+public:
+    IndexedPriorityQueue() : count(0) {}
+
+    explicit IndexedPriorityQueue(int capacity) : count(0) 
+    {
+        Reserve(capacity);
+    }
+
+    // Расширяет диапазон допустимых дескрипторов до 0..capacity-1
+    void Reserve(int capacity) 
+    {
+        int oldCapacity = positions.GetSize();
+        if (capacity <= oldCapacity) return;
+
+        heap.Resize(capacity);
+        positions.Resize(capacity);
+        priorities.Resize(capacity);
+        for (int i = oldCapacity; i < capacity; i++) 
+        {
+            positions[i] = -1;
+        }
+    }
+
+    int GetCapacity() const 
+    {
+        return positions.GetSize();
+    }
+
+    bool Contains(int handle) const 
+    {
+        checkHandle(handle);
+        return positions[handle] != -1;
+    }
+
+    void Push(int handle, TPriority priority) 
+    {
+        if (Contains(handle)) 
+        {
+            throw std::runtime_error("Handle is already in the heap");
+        }
+        priorities[handle] = priority;
+        heap[count] = handle;
+        positions[handle] = count;
+        count++;
+        siftUp(count - 1);
+    }
+
+    void DecreaseKey(int handle, TPriority priority) 
+    {
+        if (!Contains(handle)) 
+        {
+            throw std::runtime_error("Handle is not in the heap");
+        }
+        if (priorities[handle] < priority) 
+        {
+            throw std::invalid_argument("New priority is greater than the current one");
+        }
+        priorities[handle] = priority;
+        siftUp(positions[handle]);
+    }
+
+    // Добавляет дескриптор или уменьшает его приоритет. Возвращает true, если куча изменилась
+    bool PushOrDecrease(int handle, TPriority priority) 
+    {
+        if (!Contains(handle)) 
+        {
+            Push(handle, priority);
+            return true;
+        }
+        if (priority < priorities[handle]) 
+        {
+            priorities[handle] = priority;
+            siftUp(positions[handle]);
+            return true;
+        }
+        return false;
+    }
+
+    int Peek() const 
+    {
+        if (count == 0) 
+        {
+            throw std::runtime_error("Priority queue is empty");
+        }
+        return heap[0];
+    }
+
+    TPriority PeekPriority() const 
+    {
+        return priorities[Peek()];
+    }
+
+    TPriority GetPriority(int handle) const 
+    {
+        if (!Contains(handle)) 
+        {
+            throw std::runtime_error("Handle is not in the heap");
+        }
+        return priorities[handle];
+    }
+
+    // Извлекает дескриптор с наименьшим приоритетом
+    int Pop() 
+    {
+        int top = Peek();
+        positions[top] = -1;
+        count--;
+        if (count > 0) 
+        {
+            place(0, heap[count]);
+            siftDown(0);
+        }
+        return top;
     }
 
     bool IsEmpty() const 
     {
-        return tree.isEmpty();
+        return count == 0;
     }
 
     int GetCount() const 
     {
-        int count = 0;
-        tree.traverseInOrder([&count](const T& value) 
-        {
-            count++;
-        });
         return count;
     }
 
+    // Очищает кучу за O(числа оставшихся элементов), сохраняя выделенную память
     void Clear() 
     {
-        tree.clear();
+        for (int i = 0; i < count; i++) 
+        {
+            positions[heap[i]] = -1;
+        }
+        count = 0;
     }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -2,23 +2,22 @@
 #define SET_H
 
 #include "binary_tree.h"
+#include "hash_table.h"
 #include <functional>
 
-template <typename T>
+// TStorage выбирает хранилище: TreeStorage (AVL-дерево) или HashStorage (хеш-таблица)
+template <typename T, typename TStorage = TreeStorage>
 class Set 
 {
 private:
-    BinaryTree<T> tree;
+    AVLTree<T> tree;
 
 public:
     Set() = default;
 
     void Add(const T& value) 
     {
-        if (!tree.contains(value)) 
-        {
-            tree.insert(value);
-        }
+        tree.insert(value);
     }
 
     void Remove(const T& value) 
@@ -33,12 +32,7 @@ public:
 
     int GetCount() const 
     {
-        int count = 0;
-        tree.traverseInOrder([&count](const T& value) 
-        {
-            count++;
-        });
-        return count;
+        return tree.getCount();
     }
 
     bool IsEmpty() const 
@@ -51,6 +45,9 @@ public:
         tree.clear();
     }
 
+    // Дереву нечего резервировать; метод есть для совместимости с хеш-хранилищем
+    void Reserve(int) {}
+
     template<typename Func>
     void ForEach(Func func) const 
     {
@@ -94,4 +91,94 @@ public:
     }
 };
 
+template <typename T>
+class Set<T, HashStorage> 
+{
+private:
+    HashTable<T, bool> table;
+
+public:
+    Set() = default;
+
+    void Add(const T& value) 
+    {
+        table.insertOrAssign(value, true);
+    }
+
+    void Remove(const T& value) 
+    {
+        table.remove(value);
+    }
+
+    bool Contains(const T& value) const 
+    {
+        return table.contains(value);
+    }
+
+    int GetCount() const 
+    {
+        return table.getCount();
+    }
+
+    bool IsEmpty() const 
+    {
+        return table.isEmpty();
+    }
+
+    void Clear() 
+    {
+        table.clear();
+    }
+
+    void Reserve(int count) 
+    {
+        table.reserve(count);
+    }
+
+    template<typename Func>
+    void ForEach(Func func) const 
+    {
+        table.forEach([&func](const T& value, bool) 
+        {
+            func(value);
+        });
+    }
+
+    Set Union(const Set& other) const 
+    {
+        Set result = *this;
+        other.ForEach([&result](const T& value) 
+        {
+            result.Add(value);
+        });
+        return result;
+    }
+
+    Set Intersection(const Set& other) const 
+    {
+        Set result;
+        this->ForEach([&other, &result](const T& value) 
+        {
+            if (other.Contains(value)) 
+            {
+                result.Add(value);
+            }
+        });
+        return result;
+    }
+
+    Set Difference(const Set& other) const 
+    {
+        Set result;
+        this->ForEach([&other, &result](const T& value) 
+        {
+            if (!other.Contains(value)) 
+            {
+                result.Add(value);
+            }
+        });
+        return result;
+    }
+};
+
 #endif
\ No newline at end of file
@@ -5,48 +5,32 @@
 #include "Sequence.h"
 #include <functional>
 
+// Доступ по индексу и поиск позиции выполняются по размерам поддеревьев AVL-дерева
+// за O(log n), без построения промежуточного массива
 template <typename T>
 class SortedSequence : public Sequence<T> 
 {
 private:
-    BinaryTree<T> tree;
-    mutable MutableArraySequence<T> cachedSequence;
-    mutable bool isCacheValid;
-
-    void rebuildCache() const 
-    {
-        if (!isCacheValid) {
-            cachedSequence = MutableArraySequence<T>();
-            tree.traverseInOrder([this](const T& value) 
-            {
-                cachedSequence.Append(value);
-            });
-            isCacheValid = true;
-        }
-    }
+    AVLTree<T> tree;
 
 public:
-    SortedSequence() : isCacheValid(false) {}
+    SortedSequence() = default;
 
     T GetFirst() const override 
     {
-        rebuildCache();
-        if (cachedSequence.GetLength() == 0) throw std::out_of_range("Sequence is empty");
-        return cachedSequence.Get(0);
+        if (tree.isEmpty()) throw std::out_of_range("Sequence is empty");
+        return tree.select(0);
     }
 
     T GetLast() const override 
     {
-        rebuildCache();
-        int length = cachedSequence.GetLength();
-        if (length == 0) throw std::out_of_range("Sequence is empty");
-        return cachedSequence.Get(length - 1);
+        if (tree.isEmpty()) throw std::out_of_range("Sequence is empty");
+        return tree.select(tree.getCount() - 1);
     }
 
     T Get(int index) const override 
     {
-        rebuildCache();
-        return cachedSequence.Get(index);
+        return tree.select(index);
     }
 
     T Get(size_t index) const override
@@ -56,8 +40,7 @@ public:
 
     int GetLength() const override 
     {
-        rebuildCache();
-        return cachedSequence.GetLength();
+        return tree.getCount();
     }
 
     size_t GetCount() const override 
@@ -68,26 +51,30 @@ public:
     void Add(const T& element) 
     {
         tree.insert(element);
-        isCacheValid = false;
     }
 
     Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override 
     {
-        rebuildCache();
-        return cachedSequence.GetSubsequence(startIndex, endIndex);
+        if (startIndex < 0 || endIndex >= tree.getCount() || startIndex > endIndex) 
+        {
+            throw std::out_of_range("Неверный диапазон индексов");
+        }
+
+        auto* result = new MutableArraySequence<T>();
+        for (int i = startIndex; i <= endIndex; i++) 
+        {
+            result->Append(tree.select(i));
+        }
+        return result;
     }
 
     int IndexOf(const T& element) const 
     {
-        rebuildCache();
-        for (int i = 0; i < cachedSequence.GetLength(); i++) 
+        if (!tree.contains(element)) 
         {
-            if (cachedSequence.Get(i) == element) 
-            {
-                return i;
-            }
+            return -1;
         }
-        return -1;
+        return tree.rank(element);
     }
 
     bool Contains(const T& element) const 
@@ -98,14 +85,17 @@ public:
     void Remove(const T& element) 
     {
         tree.remove(element);
-        isCacheValid = false;
     }
 
     void Clear() 
     {
         tree.clear();
-        isCacheValid = false;
+    }
+
+    IIterator<T>* CreateIterator() const override 
+    {
+        return tree.CreateIterator();
     }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,187 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Пул потоков фиксированного размера для параллельных циклов по индексам.
+// Вызывающий поток участвует в работе как исполнитель с номером 0, поэтому пул
+// из N потоков держит N - 1 фоновых потоков. Индексы раздаются блоками через
+// атомарный счётчик, так что неравные по стоимости итерации балансируются сами.
+// Вложенный ParallelFor из тела цикла выполняется последовательно в текущем потоке.
+class ThreadPool 
+{
+private:
+    std::vector<std::thread> workers;
+    std::mutex submitMutex;   // одновременно выполняется один ParallelFor
+    std::mutex stateMutex;
+    std::condition_variable wakeUp;
+    std::condition_variable finished;
+
+    const std::function<void(int, int)>* job;
+    std::atomic<int> nextIndex;
+    int endIndex;
+    int chunkSize;
+    long generation;
+    int activeWorkers;
+    bool stopping;
+    std::exception_ptr failure;
+
+    static bool& insideWorker() 
+    {
+        thread_local bool inside = false;
+        return inside;
+    }
+
+    // Забирает блоки индексов, пока они не кончатся; первая ошибка запоминается,
+    // остальные итерации после неё пропускаются
+    void runChunks(int worker) 
+    {
+        insideWorker() = true;
+        while (true) 
+        {
+            int begin = nextIndex.fetch_add(chunkSize);
+            if (begin >= endIndex) break;
+            int end = std::min(begin + chunkSize, endIndex);
+            try 
+            {
+                for (int i = begin; i < end; i++) 
+                {
+                    (*job)(i, worker);
+                }
+            }
+            catch (...) 
+            {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                if (!failure) 
+                {
+                    failure = std::current_exception();
+                }
+                nextIndex.store(endIndex);
+            }
+        }
+        insideWorker() = false;
+    }
+
+    void workerLoop(int worker) 
+    {
+        long seen = 0;
+        while (true) 
+        { 
+            {
+                std::unique_lock<std::mutex> lock(stateMutex);
+                wakeUp.wait(lock, [&] { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+            }
+            runChunks(worker); 
+            {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                activeWorkers--;
+            }
+            finished.notify_one();
+        }
+    }
+
+public:
+    // threadCount <= 0 - по числу аппаратных потоков
+    explicit ThreadPool(int threadCount = 0)
+        : job(nullptr), nextIndex(0), endIndex(0), chunkSize(1), generation(0), activeWorkers(0), stopping(false) 
+    {
+        if (threadCount <= 0) 
+        {
+            threadCount = static_cast<int>(std::thread::hardware_concurrency());
+            if (threadCount <= 0) threadCount = 1;
+        }
+        for (int worker = 1; worker < threadCount; worker++) 
+        {
+            workers.emplace_back(&ThreadPool::workerLoop, this, worker);
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() 
+    { 
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            stopping = true;
+        }
+        wakeUp.notify_all();
+        for (std::thread& worker : workers) 
+        {
+            worker.join();
+        }
+    }
+
+    // Общий пул программы
+    static ThreadPool& Shared() 
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    // Число исполнителей, включая вызывающий поток: номера worker лежат в [0, GetThreadCount())
+    int GetThreadCount() const 
+    {
+        return static_cast<int>(workers.size()) + 1;
+    }
+
+    // Вызывает body(i, worker) для всех i из [begin, end) и ждёт завершения.
+    // Номер worker позволяет держать рабочую память отдельно для каждого потока.
+    // Исключение из body пробрасывается вызывающему после остановки цикла
+    void ParallelFor(int begin, int end, const std::function<void(int, int)>& body, int chunk = 0) 
+    {
+        if (begin >= end) return;
+        if (workers.empty() || insideWorker()) 
+        {
+            for (int i = begin; i < end; i++) 
+            {
+                body(i, 0);
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> submit(submitMutex);
+        if (chunk <= 0) 
+        {
+            // Около восьми блоков на поток: достаточно для балансировки, мало для атомарного счётчика
+            chunk = std::max(1, (end - begin) / (GetThreadCount() * 8));
+        } 
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            job = &body;
+            nextIndex.store(begin);
+            endIndex = end;
+            chunkSize = chunk;
+            failure = nullptr;
+            activeWorkers = static_cast<int>(workers.size());
+            generation++;
+        }
+        wakeUp.notify_all();
+
+        runChunks(0);
+
+        std::exception_ptr error; 
+        {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            finished.wait(lock, [&] { return activeWorkers == 0; });
+            job = nullptr;
+            error = failure;
+            failure = nullptr;
+        }
+        if (error) 
+        {
+            std::rethrow_exception(error);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,435 @@
+#ifndef ALL_PAIRS_SHORTEST_PATHS_H
+#define ALL_PAIRS_SHORTEST_PATHS_H
+
+#include "ShortestPath.h"
+#include "../graph/CsrGraph.h"
+#include "../structures/DynamicArray.h"
+#include "../structures/Dictionary.h"
+#include "../structures/thread_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// Матрица кратчайших расстояний между всеми парами вершин.
+// Расстояния лежат одним непрерывным блоком по строкам: Get(from, to) = data[from * V + to],
+// поэтому запрос по индексам - O(1), а по вершинам - O(1) в среднем (хеш-таблица индексов).
+// Формат файла повторяет раскладку в памяти: заголовок, вершины, затем матрица с отступа
+// GetDataOffset(V), выровненного на 8 байт, так что файл можно отобразить в память целиком
+template<typename T>
+class DistanceMatrix 
+{
+private:
+    static const uint32_t MAGIC = 0x54414d44;   // "DMAT"
+    static const uint32_t VERSION = 1;
+    static const int MAX_VERTICES = 46340;      // наибольшее V, при котором V * V помещается в int
+
+    DynamicArray<T> vertices;
+    Dictionary<T, int, IndexStorage<T>> indices;
+    DynamicArray<double> data;
+    int n;
+
+    void checkIndex(int index) const 
+    {
+        if (index < 0 || index >= n) 
+        {
+            throw std::out_of_range("Vertex index out of range");
+        }
+    }
+
+    // Размер DynamicArray - int, поэтому V * V ячеек должны в него поместиться
+    static void checkVertexCount(long long vertexCount) 
+    {
+        if (vertexCount > MAX_VERTICES) 
+        {
+            throw std::length_error("Distance matrix supports at most 46340 vertices");
+        }
+    }
+
+public:
+    DistanceMatrix() : n(0) {}
+
+    // Матрица для вершин снимка: нули на диагонали, бесконечность в остальных ячейках
+    explicit DistanceMatrix(const CsrGraph<T>& graph) : n(graph.GetVertexCount()) 
+    {
+        checkVertexCount(n);
+        vertices.Reserve(n);
+        indices.Reserve(n);
+        for (int i = 0; i < n; i++) 
+        {
+            vertices.PushBack(graph.GetVertex(i));
+            indices.Add(graph.GetVertex(i), i);
+        }
+        long long cells = static_cast<long long>(n) * n;
+        data = DynamicArray<double>(static_cast<int>(cells));
+        double* d = data.Data();
+        for (long long i = 0; i < cells; i++) 
+        {
+            d[i] = std::numeric_limits<double>::infinity();
+        }
+        for (int i = 0; i < n; i++) 
+        {
+            d[static_cast<long long>(i) * n + i] = 0.0;
+        }
+    }
+
+    int GetVertexCount() const { return n; }
+
+    const T& GetVertex(int index) const 
+    {
+        checkIndex(index);
+        return vertices[index];
+    }
+
+    // Индекс вершины или -1, если её нет
+    int IndexOf(const T& vertex) const 
+    {
+        const int* index = indices.TryGet(vertex);
+        return index != nullptr ? *index : -1;
+    }
+
+    double Get(int from, int to) const 
+    {
+        checkIndex(to);
+        return Row(from)[to];
+    }
+
+    double GetDistance(const T& from, const T& to) const 
+    {
+        int i = IndexOf(from);
+        int j = IndexOf(to);
+        if (i == -1 || j == -1) 
+        {
+            throw std::runtime_error("Vertex does not exist");
+        }
+        return Row(i)[j];
+    }
+
+    bool HasPath(const T& from, const T& to) const 
+    {
+        return GetDistance(from, to) != std::numeric_limits<double>::infinity();
+    }
+
+    // Строка расстояний от вершины index: V подряд лежащих значений
+    double* Row(int index) 
+    {
+        checkIndex(index);
+        return data.Data() + static_cast<long long>(index) * n;
+    }
+
+    const double* Row(int index) const 
+    {
+        checkIndex(index);
+        return data.Data() + static_cast<long long>(index) * n;
+    }
+
+    // Эксцентриситет вершины: наибольшее конечное расстояние в её строке
+    double GetEccentricity(int index) const 
+    {
+        const double* row = Row(index);
+        double result = 0.0;
+        for (int j = 0; j < n; j++) 
+        {
+            if (row[j] != std::numeric_limits<double>::infinity() && row[j] > result) 
+            {
+                result = row[j];
+            }
+        }
+        return result;
+    }
+
+    // Смещение матрицы от начала файла для V вершин
+    static long long GetDataOffset(int vertexCount) 
+    {
+        long long header = 4 * sizeof(uint32_t) + static_cast<long long>(vertexCount) * sizeof(T);
+        return (header + 7) / 8 * 8;
+    }
+
+    void Save(std::ostream& os) const 
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "DistanceMatrix::Save requires trivially copyable vertices");
+        uint32_t header[4] = { MAGIC, VERSION, static_cast<uint32_t>(n), static_cast<uint32_t>(sizeof(T)) };
+        os.write(reinterpret_cast<const char*>(header), sizeof(header));
+        os.write(reinterpret_cast<const char*>(vertices.Data()), static_cast<std::streamsize>(n) * sizeof(T));
+        long long padding = GetDataOffset(n) - static_cast<long long>(sizeof(header)) - static_cast<long long>(n) * sizeof(T);
+        const char zeros[8] = {};
+        os.write(zeros, static_cast<std::streamsize>(padding));
+        os.write(reinterpret_cast<const char*>(data.Data()), static_cast<std::streamsize>(n) * n * sizeof(double));
+        if (!os) 
+        {
+            throw std::runtime_error("Failed to write distance matrix");
+        }
+    }
+
+    static DistanceMatrix Load(std::istream& is) 
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "DistanceMatrix::Load requires trivially copyable vertices");
+        uint32_t header[4] = {};
+        is.read(reinterpret_cast<char*>(header), sizeof(header));
+        if (!is || header[0] != MAGIC || header[1] != VERSION || header[3] != sizeof(T)) 
+        {
+            throw std::runtime_error("Invalid distance matrix format");
+        }
+
+        checkVertexCount(header[2]);
+        DistanceMatrix result;
+        result.n = static_cast<int>(header[2]);
+        result.vertices = DynamicArray<T>(result.n);
+        is.read(reinterpret_cast<char*>(result.vertices.Data()), static_cast<std::streamsize>(result.n) * sizeof(T));
+        long long padding = GetDataOffset(result.n) - static_cast<long long>(sizeof(header)) - static_cast<long long>(result.n) * sizeof(T);
+        is.ignore(static_cast<std::streamsize>(padding));
+        result.data = DynamicArray<double>(static_cast<int>(static_cast<long long>(result.n) * result.n));
+        is.read(reinterpret_cast<char*>(result.data.Data()), static_cast<std::streamsize>(result.n) * result.n * sizeof(double));
+        if (!is) 
+        {
+            throw std::runtime_error("Invalid distance matrix format");
+        }
+
+        result.indices.Reserve(result.n);
+        for (int i = 0; i < result.n; i++) 
+        {
+            result.indices.Add(result.vertices[i], i);
+        }
+        return result;
+    }
+
+    void SaveToFile(const std::string& path) const 
+    {
+        std::ofstream file(path, std::ios::binary);
+        if (!file) 
+        {
+            throw std::runtime_error("Cannot open file for writing");
+        }
+        Save(file);
+    }
+
+    static DistanceMatrix LoadFromFile(const std::string& path) 
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) 
+        {
+            throw std::runtime_error("Cannot open file for reading");
+        }
+        return Load(file);
+    }
+};
+
+// Кратчайшие расстояния между всеми парами вершин
+template<typename T>
+class AllPairsShortestPaths 
+{
+private:
+    static const int BLOCK = 64;   // сторона блока Флойда-Уоршелла: три блока 64x64 double помещаются в L2
+
+    // Релаксация блока (I, J) через промежуточные вершины блока K.
+    // Внутренний цикл по j - непрерывная строка без ветвлений, векторизуется через omp simd (-fopenmp-simd).
+    // Без прагмы GCC при -O2 его не векторизует: rowI может совпасть с rowK (i == k).
+    // Совпадение безопасно: итерация j читает и пишет только элемент j
+    static void UpdateBlock(double* d, int n, int I, int J, int K) 
+    {
+        const double INF = std::numeric_limits<double>::infinity();
+        int iEnd = std::min(n, (I + 1) * BLOCK);
+        int jBegin = J * BLOCK;
+        int jEnd = std::min(n, (J + 1) * BLOCK);
+        int kEnd = std::min(n, (K + 1) * BLOCK);
+        for (int k = K * BLOCK; k < kEnd; k++) 
+        {
+            const double* rowK = d + static_cast<long long>(k) * n;
+            for (int i = I * BLOCK; i < iEnd; i++) 
+            {
+                double* rowI = d + static_cast<long long>(i) * n;
+                double dik = rowI[k];
+                if (dik == INF) continue;
+#pragma omp simd
+                for (int j = jBegin; j < jEnd; j++) 
+                {
+                    double candidate = dik + rowK[j];
+                    rowI[j] = candidate < rowI[j] ? candidate : rowI[j];
+                }
+            }
+        }
+    }
+
+    static void CheckDiagonal(const DistanceMatrix<T>& matrix) 
+    {
+        for (int i = 0; i < matrix.GetVertexCount(); i++) 
+        {
+            if (matrix.Get(i, i) < 0.0) 
+            {
+                throw std::runtime_error("Graph contains negative cycle");
+            }
+        }
+    }
+
+    // Потенциалы Джонсона: расстояния от фиктивной вершины с нулевыми дугами во все вершины.
+    // Вычисляются SPFA, в котором все вершины стартуют с нулём; путь из V дуг означает отрицательный цикл
+    static DynamicArray<double> ComputePotentials(const CsrGraph<T>& graph) 
+    {
+        int n = graph.GetVertexCount();
+        DynamicArray<double> potential(n);
+        bool hasNegative = false;
+        for (int u = 0; u < n && !hasNegative; u++) 
+        {
+            auto neighbors = graph.GetNeighbors(u);
+            for (int k = 0; k < neighbors.GetCount(); k++) 
+            {
+                hasNegative = hasNegative || neighbors.Weight(k) < 0.0;
+            }
+        }
+        if (!hasNegative) return potential;
+
+        Deque<int> queue(n);
+        DynamicArray<bool> queued(n);
+        DynamicArray<int> pathLength(n);
+        for (int v = 0; v < n; v++) 
+        {
+            queue.PushBack(v);
+            queued[v] = true;
+        }
+        while (!queue.IsEmpty()) 
+        {
+            int from = queue.PopFront();
+            queued[from] = false;
+            auto neighbors = graph.GetNeighbors(from);
+            for (int k = 0; k < neighbors.GetCount(); k++) 
+            {
+                int to = neighbors.Target(k);
+                double candidate = potential[from] + neighbors.Weight(k);
+                if (!(candidate < potential[to])) continue;
+                potential[to] = candidate;
+                pathLength[to] = pathLength[from] + 1;
+                if (pathLength[to] >= n) 
+                {
+                    throw std::runtime_error("Graph contains negative cycle");
+                }
+                if (!queued[to]) 
+                {
+                    queued[to] = true;
+                    queue.PushBack(to);
+                }
+            }
+        }
+        return potential;
+    }
+
+public:
+    // Блочный Флойд-Уоршелл за O(V^3): для каждого блока K сначала диагональный блок,
+    // затем блоки его строки и столбца, затем все остальные; блоки второй и третьей фазы
+    // независимы и считаются параллельно
+    static DistanceMatrix<T> FloydWarshall(const CsrGraph<T>& graph, ThreadPool& pool) 
+    {
+        DistanceMatrix<T> matrix(graph);
+        int n = graph.GetVertexCount();
+        if (n == 0) return matrix;
+        double* d = matrix.Row(0);
+        for (int u = 0; u < n; u++) 
+        {
+            auto neighbors = graph.GetNeighbors(u);
+            for (int k = 0; k < neighbors.GetCount(); k++) 
+            {
+                double& cell = d[static_cast<long long>(u) * n + neighbors.Target(k)];
+                cell = std::min(cell, neighbors.Weight(k));
+            }
+        }
+
+        int blocks = (n + BLOCK - 1) / BLOCK;
+        for (int K = 0; K < blocks; K++) 
+        {
+            UpdateBlock(d, n, K, K, K);
+            pool.ParallelFor(0, 2 * blocks, [&](int index, int) 
+            {
+                int other = index / 2;
+                if (other == K) return;
+                if (index % 2 == 0) 
+                {
+                    UpdateBlock(d, n, K, other, K);
+                }
+                else 
+                {
+                    UpdateBlock(d, n, other, K, K);
+                }
+            }, 1);
+            pool.ParallelFor(0, blocks * blocks, [&](int index, int) 
+            {
+                int I = index / blocks;
+                int J = index % blocks;
+                if (I == K || J == K) return;
+                UpdateBlock(d, n, I, J, K);
+            }, 1);
+        }
+
+        CheckDiagonal(matrix);
+        return matrix;
+    }
+
+    static DistanceMatrix<T> FloydWarshall(const CsrGraph<T>& graph) 
+    {
+        return FloydWarshall(graph, ThreadPool::Shared());
+    }
+
+    // Джонсон за O(V E log V): перевзвешивание w'(u, v) = w + h(u) - h(v) >= 0 по потенциалам,
+    // затем Дейкстра из каждой вершины параллельно, у каждого потока своя рабочая память,
+    // каждая строка матрицы пишется одним потоком
+    static DistanceMatrix<T> Johnson(const CsrGraph<T>& graph, ThreadPool& pool) 
+    {
+        DistanceMatrix<T> matrix(graph);
+        int n = graph.GetVertexCount();
+        if (n == 0) return matrix;
+
+        DynamicArray<double> potential = ComputePotentials(graph);
+        // Отсечение на нуле гасит ошибки округления вида -1e-16
+        CsrGraph<T> reweighted = graph.MapWeights([&potential](int from, int to, double weight) 
+        {
+            return std::max(0.0, weight + potential[from] - potential[to]);
+        });
+
+        DynamicArray<DijkstraWorkspace> workspaces(pool.GetThreadCount());
+        pool.ParallelFor(0, n, [&](int source, int worker) 
+        {
+            DijkstraWorkspace& workspace = workspaces[worker];
+            ShortestPath<T>::RunDijkstra(reweighted, source, -1, workspace);
+            double* row = matrix.Row(source);
+            for (int i = 0; i < workspace.GetReachedCount(); i++) 
+            {
+                int v = workspace.GetReached(i);
+                row[v] = workspace.GetDistance(v) - potential[source] + potential[v];
+            }
+        }, 1);
+        return matrix;
+    }
+
+    static DistanceMatrix<T> Johnson(const CsrGraph<T>& graph) 
+    {
+        return Johnson(graph, ThreadPool::Shared());
+    }
+
+    // Выбор алгоритма по плотности: Флойд-Уоршелл выгоднее, когда E log V сравнимо с V^2
+    // (внутренний цикл Флойда-Уоршелла под omp simd примерно вчетверо дешевле релаксации в куче;
+    // без -fopenmp-simd он скалярный и почти вдвое медленнее, тогда порог завышает выгоду Флойда-Уоршелла)
+    static DistanceMatrix<T> Compute(const CsrGraph<T>& graph, ThreadPool& pool) 
+    {
+        int n = graph.GetVertexCount();
+        double logV = std::log2(static_cast<double>(std::max(2, n)));
+        bool dense = 4.0 * graph.GetArcCount() * logV >= static_cast<double>(n) * n;
+        return dense ? FloydWarshall(graph, pool) : Johnson(graph, pool);
+    }
+
+    static DistanceMatrix<T> Compute(const CsrGraph<T>& graph) 
+    {
+        return Compute(graph, ThreadPool::Shared());
+    }
+
+    static DistanceMatrix<T> Compute(const GraphBase<T>& graph) 
+    {
+        return Compute(CsrGraph<T>(graph));
+    }
+};
+
+#endif // ALL_PAIRS_SHORTEST_PATHS_H
@@ -3,8 +3,14 @@
 
 #include "../graph/UndirectedGraph.h"
 #include "../graph/GraphBase.h"
+#include "../graph/CsrGraph.h"
 #include "../structures/Set.h"
 #include "../structures/Sequence.h"
+#include "../structures/Dictionary.h"
+#include "../structures/disjoint_set.h"
+#include "../structures/thread_pool.h"
+#include <algorithm>
+#include <atomic>
 #include <stdexcept>
 
 template<typename T>
@@ -12,7 +18,7 @@ class ConnectedComponents
 {
 private:
     // Функция BFS для поиска компоненты связности
-    static void BFSComponent(const UndirectedGraph<T>& graph, T startVertex, Set<T>& visited, MutableArraySequence<T>* component) 
+    static void BFSComponent(const UndirectedGraph<T>& graph, T startVertex, Set<T, IndexStorage<T>>& visited, MutableArraySequence<T>* component) 
     {
         Queue<T> queue;
         queue.Enqueue(startVertex);
@@ -37,40 +43,12 @@ private:
         }
     }
     
-    // Функция DFS для поиска компоненты связности
-    static void DFSComponent(const UndirectedGraph<T>& graph, T vertex, Set<T>& visited, MutableArraySequence<T>* component) 
-    {
-        Stack<T> stack;
-        stack.Push(vertex);
-        
-        while (!stack.IsEmpty()) 
-        {
-            T current = stack.Pop();
-            
-            if (visited.Contains(current)) continue;
-            
-            visited.Add(current);
-            component->Append(current);
-            
-            auto adj = graph.GetAdjacentVertices(current);
-            for (int i = 0; i < adj->GetLength(); i++) 
-            {
-                T neighbor = adj->Get(i);
-                if (!visited.Contains(neighbor)) 
-                {
-                    stack.Push(neighbor);
-                }
-            }
-            delete adj;
-        }
-    }
-
 public:
     // Нахождение всех компонент связности
     static Sequence<Sequence<T>*>* FindComponentsBFS(const UndirectedGraph<T>& graph) 
     {
         auto* components = new MutableArraySequence<Sequence<T>*>();
-        Set<T> visited;
+        Set<T, IndexStorage<T>> visited;
         auto vertices = graph.GetAllVertices();
         
         for (int i = 0; i < vertices->GetLength(); i++) 
@@ -92,41 +70,14 @@ public:
     // Нахождение всех компонент связности 
     static Sequence<Sequence<T>*>* FindComponentsDFS(const UndirectedGraph<T>& graph) 
     {
-        auto* components = new MutableArraySequence<Sequence<T>*>();
-        Set<T> visited;
-        auto vertices = graph.GetAllVertices();
-        
-        for (int i = 0; i < vertices->GetLength(); i++) 
-        {
-            T vertex = vertices->Get(i);
-            
-            if (!visited.Contains(vertex)) 
-            {
-                auto* component = new MutableArraySequence<T>();
-                DFSComponent(graph, vertex, visited, component);
-                components->Append(component);
-            }
-        }
-        
-        delete vertices;
-        return components;
+        return FindComponentsDFS(CsrGraph<T>(graph));
     }
     
     // Проверка, является ли граф связным
     static bool IsConnected(const UndirectedGraph<T>& graph) 
     {
         if (graph.GetVertexCount() == 0) return true;
-        
-        auto components = FindComponentsBFS(graph);
-        bool isConnected = (components->GetLength() == 1);
-        
-        for (int i = 0; i < components->GetLength(); i++) 
-        {
-            delete components->Get(i);
-        }
-        delete components;
-        
-        return isConnected;
+        return IsConnected(CsrGraph<T>(graph));
     }
     
     // Нахождение компоненты связности для конкретной вершины
@@ -137,7 +88,7 @@ public:
         }
         
         auto* component = new MutableArraySequence<T>();
-        Set<T> visited;
+        Set<T, IndexStorage<T>> visited;
         BFSComponent(graph, vertex, visited, component);
         
         return component;
@@ -155,16 +106,7 @@ public:
     // Подсчёт количества компонент связности
     static int CountComponents(const UndirectedGraph<T>& graph) 
     {
-        auto components = FindComponentsBFS(graph);
-        int count = components->GetLength();
-        
-        for (int i = 0; i < components->GetLength(); i++)
-        {
-            delete components->Get(i);
-        }
-        delete components;
-        
-        return count;
+        return CountComponents(CsrGraph<T>(graph));
     }
     
     // Нахождение самой большой компоненты связности
@@ -265,6 +207,403 @@ public:
         delete component;
         return connected;
     }
+
+    // Разметка компонент на CSR-снимке неориентированного графа.
+    // labels[v] получает номер компоненты вершины v (нумерация с 0 в порядке индексов),
+    // order (если задан) - вершины в порядке обхода BFS: компоненты идут подряд.
+    // Возвращает число компонент
+    static int LabelComponents(const CsrGraph<T>& graph, DynamicArray<int>& labels, DynamicArray<int>* order = nullptr) 
+    {
+        if (graph.IsDirected()) 
+        {
+            throw std::runtime_error("Graph must be undirected");
+        }
+        
+        int n = graph.GetVertexCount();
+        labels = DynamicArray<int>(n);
+        for (int i = 0; i < n; i++) 
+        {
+            labels[i] = -1;
+        }
+        DynamicArray<int> queue(n);
+        int tail = 0;
+        int count = 0;
+        
+        for (int start = 0; start < n; start++) 
+        {
+            if (labels[start] != -1) continue;
+            
+            int head = tail;
+            labels[start] = count;
+            queue[tail++] = start;
+            while (head < tail) 
+            {
+                int current = queue[head++];
+                for (int neighbor : graph.GetNeighbors(current)) 
+                {
+                    if (labels[neighbor] == -1) 
+                    {
+                        labels[neighbor] = count;
+                        queue[tail++] = neighbor;
+                    }
+                }
+            }
+            count++;
+        }
+        
+        if (order != nullptr) 
+        {
+            *order = std::move(queue);
+        }
+        return count;
+    }
+    
+private:
+    // Подвешивает деревья u и v друг к другу: корень с большим номером - к меньшему.
+    // CAS гарантирует, что корень подвешивается один раз; при гонке попытка повторяется
+    // с новыми предками (связывание из алгоритма Afforest)
+    static void Link(DynamicArray<std::atomic<int>>& parent, int u, int v) 
+    {
+        int p1 = parent[u].load(std::memory_order_relaxed);
+        int p2 = parent[v].load(std::memory_order_relaxed);
+        while (p1 != p2) 
+        {
+            int high = std::max(p1, p2);
+            int low = std::min(p1, p2);
+            int highParent = parent[high].load(std::memory_order_relaxed);
+            if (highParent == low) break;
+            if (highParent == high) 
+            {
+                int expected = high;
+                if (parent[high].compare_exchange_strong(expected, low, std::memory_order_acq_rel)) break;
+            }
+            p1 = parent[parent[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+            p2 = parent[low].load(std::memory_order_relaxed);
+        }
+    }
+
+    // Прыжки по указателям: каждая вершина ссылается прямо на корень своего дерева
+    static void Compress(DynamicArray<std::atomic<int>>& parent, int n, ThreadPool& pool) 
+    {
+        pool.ParallelFor(0, n, [&](int v, int) 
+        {
+            int p = parent[v].load(std::memory_order_relaxed);
+            int grand = parent[p].load(std::memory_order_relaxed);
+            while (p != grand) 
+            {
+                parent[v].store(grand, std::memory_order_relaxed);
+                p = grand;
+                grand = parent[p].load(std::memory_order_relaxed);
+            }
+        });
+    }
+
+    // Самый частый корень среди 1024 случайных вершин - почти наверняка гигантская компонента
+    static int SampleFrequentRoot(const DynamicArray<std::atomic<int>>& parent, int n) 
+    {
+        const int SAMPLES = 1024;
+        DynamicArray<int> samples(SAMPLES);
+        unsigned int seed = 27491u;
+        for (int i = 0; i < SAMPLES; i++) 
+        {
+            seed = seed * 1103515245u + 12345u;
+            samples[i] = parent[static_cast<int>((seed >> 4) % static_cast<unsigned int>(n))].load(std::memory_order_relaxed);
+        }
+        std::sort(samples.Data(), samples.Data() + SAMPLES);
+        int best = samples[0];
+        int bestCount = 0;
+        for (int i = 0; i < SAMPLES; ) 
+        {
+            int j = i;
+            while (j < SAMPLES && samples[j] == samples[i]) j++;
+            if (j - i > bestCount) 
+            {
+                bestCount = j - i;
+                best = samples[i];
+            }
+            i = j;
+        }
+        return best;
+    }
+
+public:
+    // Параллельная разметка компонент алгоритмом Afforest (Sutton и др., развитие Шилоаха-Вишкина).
+    // Сначала связываются только первые NEIGHBOR_ROUNDS соседей каждой вершины и деревья сжимаются;
+    // по выборке определяется самая большая компонента, и остальные рёбра просматриваются только
+    // у вершин вне неё: на графах с гигантской компонентой большая часть рёбер не трогается.
+    // Нумерация компонент и labels совпадают с LabelComponents; sizes[c] - размер компоненты c.
+    // Возвращает число компонент
+    static int LabelComponentsParallel(const CsrGraph<T>& graph, DynamicArray<int>& labels, DynamicArray<int>& sizes, ThreadPool& pool) 
+    {
+        const int NEIGHBOR_ROUNDS = 2;
+        if (graph.IsDirected()) 
+        {
+            throw std::runtime_error("Graph must be undirected");
+        }
+
+        int n = graph.GetVertexCount();
+        labels = DynamicArray<int>(n);
+        if (n == 0) 
+        {
+            sizes = DynamicArray<int>();
+            return 0;
+        }
+
+        DynamicArray<std::atomic<int>> parent(n);
+        pool.ParallelFor(0, n, [&](int v, int) 
+        {
+            parent[v].store(v, std::memory_order_relaxed);
+        });
+
+        for (int round = 0; round < NEIGHBOR_ROUNDS; round++) 
+        {
+            pool.ParallelFor(0, n, [&](int u, int) 
+            {
+                auto neighbors = graph.GetNeighbors(u);
+                if (round < neighbors.GetCount()) 
+                {
+                    Link(parent, u, neighbors.Target(round));
+                }
+            });
+            Compress(parent, n, pool);
+        }
+
+        // Рёбра вершины гигантской компоненты к внешним вершинам будут связаны со стороны внешних
+        int giant = SampleFrequentRoot(parent, n);
+        pool.ParallelFor(0, n, [&](int u, int) 
+        {
+            if (parent[u].load(std::memory_order_relaxed) == giant) return;
+            auto neighbors = graph.GetNeighbors(u);
+            for (int k = NEIGHBOR_ROUNDS; k < neighbors.GetCount(); k++) 
+            {
+                Link(parent, u, neighbors.Target(k));
+            }
+        });
+        Compress(parent, n, pool);
+
+        // Корень дерева - наименьшая вершина компоненты, поэтому нумерация корней по возрастанию
+        // даёт тот же порядок компонент, что и последовательный обход
+        int count = 0;
+        for (int v = 0; v < n; v++) 
+        {
+            if (parent[v].load(std::memory_order_relaxed) == v) 
+            {
+                labels[v] = count++;
+            }
+        }
+        sizes = DynamicArray<int>(count);
+        for (int v = 0; v < n; v++) 
+        {
+            labels[v] = labels[parent[v].load(std::memory_order_relaxed)];
+            sizes[labels[v]]++;
+        }
+        return count;
+    }
+
+    static int LabelComponentsParallel(const CsrGraph<T>& graph, DynamicArray<int>& labels, DynamicArray<int>& sizes) 
+    {
+        return LabelComponentsParallel(graph, labels, sizes, ThreadPool::Shared());
+    }
+    
+    static Sequence<Sequence<T>*>* FindComponentsBFS(const CsrGraph<T>& graph) 
+    {
+        DynamicArray<int> labels;
+        DynamicArray<int> order;
+        LabelComponents(graph, labels, &order);
+        
+        auto* components = new MutableArraySequence<Sequence<T>*>();
+        MutableArraySequence<T>* component = nullptr;
+        for (int i = 0; i < order.GetSize(); i++) 
+        {
+            int vertex = order[i];
+            if (component == nullptr || labels[vertex] != components->GetLength() - 1) 
+            {
+                component = new MutableArraySequence<T>();
+                components->Append(component);
+            }
+            component->Append(graph.GetVertex(vertex));
+        }
+        return components;
+    }
+    
+    // DFS по CSR-снимку с явным стеком индексов, выделенным один раз: каждая вершина кладёт
+    // в стек всех непосещённых соседей, поэтому стек не длиннее числа дуг плюс одна вершина.
+    // Порядок вершин в компонентах совпадает с прежним обходом по графу со стеком Stack<T>
+    static Sequence<Sequence<T>*>* FindComponentsDFS(const CsrGraph<T>& graph) 
+    {
+        if (graph.IsDirected()) 
+        {
+            throw std::runtime_error("Graph must be undirected");
+        }
+        
+        int n = graph.GetVertexCount();
+        DynamicArray<bool> visited(n);
+        DynamicArray<int> stack(graph.GetArcCount() + 1);
+        auto* components = new MutableArraySequence<Sequence<T>*>();
+        
+        for (int start = 0; start < n; start++) 
+        {
+            if (visited[start]) continue;
+            
+            auto* component = new MutableArraySequence<T>();
+            int top = 0;
+            stack[top++] = start;
+            while (top > 0) 
+            {
+                int current = stack[--top];
+                if (visited[current]) continue;
+                
+                visited[current] = true;
+                component->Append(graph.GetVertex(current));
+                for (int neighbor : graph.GetNeighbors(current)) 
+                {
+                    if (!visited[neighbor]) 
+                    {
+                        stack[top++] = neighbor;
+                    }
+                }
+            }
+            components->Append(component);
+        }
+        return components;
+    }
+    
+    static int CountComponents(const CsrGraph<T>& graph) 
+    {
+        DynamicArray<int> labels;
+        return LabelComponents(graph, labels);
+    }
+    
+    static bool IsConnected(const CsrGraph<T>& graph) 
+    {
+        return CountComponents(graph) <= 1;
+    }
+    
+    static bool AreConnected(const CsrGraph<T>& graph, T vertex1, T vertex2) 
+    {
+        int first = graph.IndexOf(vertex1);
+        int second = graph.IndexOf(vertex2);
+        if (first == -1 || second == -1) 
+        {
+            return false;
+        }
+        DynamicArray<int> labels;
+        LabelComponents(graph, labels);
+        return labels[first] == labels[second];
+    }
+};
+
+// Связность неориентированного графа, который только растёт: вершины и рёбра поступают потоком,
+// а запросы о связности, числе и размере компонент отвечаются через DisjointSet без обхода графа.
+// Вершины получают плотные номера в порядке появления. Удаление рёбер не поддерживается
+template<typename T>
+class IncrementalConnectivity 
+{
+private:
+    DisjointSet sets;
+    Dictionary<T, int, IndexStorage<T>> indices;
+
+    int RequireIndex(const T& vertex) const 
+    {
+        const int* index = indices.TryGet(vertex);
+        if (index == nullptr) 
+        {
+            throw std::runtime_error("Vertex does not exist in graph");
+        }
+        return *index;
+    }
+
+public:
+    IncrementalConnectivity() {}
+
+    // Начальное состояние по снимку неориентированного графа; номера вершин совпадают с индексами снимка
+    explicit IncrementalConnectivity(const CsrGraph<T>& graph) 
+    {
+        if (graph.IsDirected()) 
+        {
+            throw std::runtime_error("Graph must be undirected");
+        }
+        int n = graph.GetVertexCount();
+        sets.Reserve(n);
+        indices.Reserve(n);
+        for (int i = 0; i < n; i++) 
+        {
+            AddVertex(graph.GetVertex(i));
+        }
+        for (int u = 0; u < n; u++) 
+        {
+            for (int v : graph.GetNeighbors(u)) 
+            {
+                if (u < v) sets.Union(u, v);
+            }
+        }
+    }
+
+    explicit IncrementalConnectivity(const UndirectedGraph<T>& graph) 
+        : IncrementalConnectivity(CsrGraph<T>(graph)) 
+    {
+    }
+
+    // Добавляет вершину, если её ещё нет; возвращает её номер
+    int AddVertex(const T& vertex) 
+    {
+        const int* index = indices.TryGet(vertex);
+        if (index != nullptr) return *index;
+        int added = sets.AddElement();
+        indices.Add(vertex, added);
+        return added;
+    }
+
+    // Добавляет ребро (и недостающие вершины); true, если ребро объединило две компоненты
+    bool AddEdge(const T& from, const T& to) 
+    {
+        int first = AddVertex(from);
+        int second = AddVertex(to);
+        return sets.Union(first, second);
+    }
+
+    bool HasVertex(const T& vertex) const 
+    {
+        return indices.TryGet(vertex) != nullptr;
+    }
+
+    // false, если хотя бы одной вершины нет (как у ConnectedComponents::AreConnected)
+    bool AreConnected(const T& vertex1, const T& vertex2) 
+    {
+        const int* first = indices.TryGet(vertex1);
+        const int* second = indices.TryGet(vertex2);
+        if (first == nullptr || second == nullptr) 
+        {
+            return false;
+        }
+        return sets.AreConnected(*first, *second);
+    }
+
+    int GetComponentSize(const T& vertex) 
+    {
+        return sets.GetSetSize(RequireIndex(vertex));
+    }
+
+    // Номер представителя компоненты: совпадает у вершин одной компоненты до следующего AddEdge
+    int GetComponentId(const T& vertex) 
+    {
+        return sets.Find(RequireIndex(vertex));
+    }
+
+    int CountComponents() const 
+    {
+        return sets.GetSetCount();
+    }
+
+    bool IsConnected() const 
+    {
+        return sets.GetSetCount() <= 1;
+    }
+
+    int GetVertexCount() const 
+    {
+        return sets.GetElementCount();
+    }
 };
 
 #endif // CONNECTED_COMPONENTS_H
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define PARTIAL_ORDER_H
 
 #include "../graph/DirectedGraph.h"
+#include "../graph/CsrGraph.h"
 #include "../structures/Set.h"
 #include "../structures/Sequence.h"
 #include <stdexcept>
@@ -40,6 +41,39 @@ private:
         return true;
     }
     
+    static bool CheckAntisymmetry(const CsrGraph<T>& graph) 
+    {
+        for (int u = 0; u < graph.GetVertexCount(); u++) 
+        {
+            for (int v : graph.GetNeighbors(u)) 
+            {
+                if (graph.HasArc(v, u)) 
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+    
+    // Вершины, у которых есть дуга от другой вершины (для minimal) или к другой вершине (для maximal)
+    static DynamicArray<bool> MarkNonExtremal(const CsrGraph<T>& graph, bool byIncoming) 
+    {
+        int n = graph.GetVertexCount();
+        DynamicArray<bool> marked(n);
+        for (int u = 0; u < n; u++) 
+        {
+            for (int v : graph.GetNeighbors(u)) 
+            {
+                if (v != u) 
+                {
+                    marked[byIncoming ? v : u] = true;
+                }
+            }
+        }
+        return marked;
+    }
+    
     // Функция для нахождения достижимых вершин из start
     static Set<T>* GetReachableVertices(const DirectedGraph<T>& graph, T start) 
     {
@@ -73,6 +107,49 @@ private:
         return reachable;
     }
     
+    // Вершины, из которых достижима start (обход по входящим рёбрам)
+    static Set<T>* GetAncestorVertices(const DirectedGraph<T>& graph, T start) 
+    {
+        auto* ancestors = new Set<T>();
+        if (!graph.HasVertex(start)) 
+        {
+            return ancestors;
+        }
+        
+        Queue<T> queue;
+        queue.Enqueue(start);
+        ancestors->Add(start);
+        
+        while (!queue.IsEmpty()) 
+        {
+            T current = queue.Dequeue();
+            graph.ForEachEdgeTo(current, [&](const T& predecessor, double) 
+            {
+                if (!ancestors->Contains(predecessor)) 
+                {
+                    ancestors->Add(predecessor);
+                    queue.Enqueue(predecessor);
+                }
+            });
+        }
+        
+        return ancestors;
+    }
+    
+    // Элементы, лежащие в обоих множествах
+    static MutableArraySequence<T>* Intersect(const Set<T>& first, const Set<T>& second) 
+    {
+        auto* result = new MutableArraySequence<T>();
+        first.ForEach([&](const T& value) 
+        {
+            if (second.Contains(value)) 
+            {
+                result->Append(value);
+            }
+        });
+        return result;
+    }
+    
     static bool IsLessOrEqual(const DirectedGraph<T>& partialOrder, T a, T b) 
     {
         if (a == b) return true;
@@ -173,25 +250,15 @@ private:
 
 public:
     // Проверка, является ли граф отношением частичного порядка
+    static bool IsPartialOrder(const CsrGraph<T>& graph) 
+    {
+        // Антисимметричность и ацикличность (частичный порядок должен быть ациклическим)
+        return CheckAntisymmetry(graph) && TopologicalSort<T>::IsAcyclic(graph);
+    }
+    
     static bool IsPartialOrder(const DirectedGraph<T>& graph) 
     {      
-        // Проверка антисимметричности
-        if (!CheckAntisymmetry(graph)) 
-        {
-            return false; 
-        }
-        
-        // Проверка ацикличности (частичный порядок должен быть ациклическим)
-        try 
-        {
-            auto topological = TopologicalSort<T>::KahnSort(graph);
-            delete topological;
-            return true;
-        } 
-        catch (const std::runtime_error&) 
-        {
-            return false;
-        }
+        return IsPartialOrder(CsrGraph<T>(graph));
     }
     
     // Построение диаграммы Хассе из отношения частичного порядка
@@ -251,74 +318,78 @@ public:
     }
     
     // Нахождение минимальных элементов
-    static Sequence<T>* FindMinimalElements(const DirectedGraph<T>& partialOrder) 
+    static Sequence<T>* FindMinimalElements(const CsrGraph<T>& partialOrder) 
     {
         if (!IsPartialOrder(partialOrder)) 
         {
             throw std::runtime_error("Graph is not a partial order");
         }
         
+        DynamicArray<bool> hasPredecessor = MarkNonExtremal(partialOrder, true);
         auto* minimal = new MutableArraySequence<T>();
-        auto vertices = partialOrder.GetAllVertices();
-        
-        for (int i = 0; i < vertices->GetLength(); i++) 
+        for (int i = 0; i < partialOrder.GetVertexCount(); i++) 
         {
-            T vertex = vertices->Get(i);
-            bool isMinimal = true;
-            
-            for (int j = 0; j < vertices->GetLength(); j++) 
+            if (!hasPredecessor[i]) 
             {
-                T other = vertices->Get(j);
-                if (other != vertex && partialOrder.HasEdge(other, vertex)) 
-                {
-                    isMinimal = false;
-                    break;
-                }
-            }
-            
-            if (isMinimal) 
-            {
-                minimal->Append(vertex);
+                minimal->Append(partialOrder.GetVertex(i));
             }
         }
+        return minimal;
+    }
+    
+    static Sequence<T>* FindMinimalElements(const DirectedGraph<T>& partialOrder) 
+    {
+        if (!IsPartialOrder(partialOrder)) 
+        {
+            throw std::runtime_error("Graph is not a partial order");
+        }
         
-        delete vertices;
+        auto* minimal = new MutableArraySequence<T>();
+        partialOrder.ForEachVertex([&](const T& v) 
+        {
+            if (IsMinimalElement(partialOrder, v)) 
+            {
+                minimal->Append(v);
+            }
+        });
         return minimal;
     }
     
     // Нахождение максимальных элементов
-    static Sequence<T>* FindMaximalElements(const DirectedGraph<T>& partialOrder) 
+    static Sequence<T>* FindMaximalElements(const CsrGraph<T>& partialOrder) 
     {
         if (!IsPartialOrder(partialOrder)) 
         {
             throw std::runtime_error("Graph is not a partial order");
         }
         
+        DynamicArray<bool> hasSuccessor = MarkNonExtremal(partialOrder, false);
         auto* maximal = new MutableArraySequence<T>();
-        auto vertices = partialOrder.GetAllVertices();
-        
-        for (int i = 0; i < vertices->GetLength(); i++) 
+        for (int i = 0; i < partialOrder.GetVertexCount(); i++) 
         {
-            T vertex = vertices->Get(i);
-            bool isMaximal = true;
-            
-            for (int j = 0; j < vertices->GetLength(); j++) 
-            {
-                T other = vertices->Get(j);
-                if (other != vertex && partialOrder.HasEdge(vertex, other)) 
-                {
-                    isMaximal = false;
-                    break;
-                }
-            }
-            
-            if (isMaximal) 
+            if (!hasSuccessor[i]) 
             {
-                maximal->Append(vertex);
+                maximal->Append(partialOrder.GetVertex(i));
             }
         }
+        return maximal;
+    }
+    
+    static Sequence<T>* FindMaximalElements(const DirectedGraph<T>& partialOrder) 
+    {
+        if (!IsPartialOrder(partialOrder)) 
+        {
+            throw std::runtime_error("Graph is not a partial order");
+        }
         
-        delete vertices;
+        auto* maximal = new MutableArraySequence<T>();
+        partialOrder.ForEachVertex([&](const T& v) 
+        {
+            if (IsMaximalElement(partialOrder, v)) 
+            {
+                maximal->Append(v);
+            }
+        });
         return maximal;
     }
     
@@ -353,29 +424,18 @@ public:
         return result;
     }
     
-    // Проверка, является ли элемент минимальным
+    // Проверка, является ли элемент минимальным: нет входящих рёбер, кроме петли
     static bool IsMinimalElement(const DirectedGraph<T>& partialOrder, T element) 
     {
         if (!partialOrder.HasVertex(element)) {
             throw std::runtime_error("Element does not exist");
         }
         
-        auto vertices = partialOrder.GetAllVertices();
-        
-        for (int i = 0; i < vertices->GetLength(); i++) {
-            T other = vertices->Get(i);
-            if (other != element && partialOrder.HasEdge(other, element))
-            {
-                delete vertices;
-                return false;
-            }
-        }
-        
-        delete vertices;
-        return true;
+        int selfLoop = partialOrder.HasEdge(element, element) ? 1 : 0;
+        return partialOrder.InDegree(element) == selfLoop;
     }
     
-    // Проверка, является ли элемент максимальным
+    // Проверка, является ли элемент максимальным: нет исходящих рёбер, кроме петли
     static bool IsMaximalElement(const DirectedGraph<T>& partialOrder, T element) 
     {
         if (!partialOrder.HasVertex(element)) 
@@ -383,19 +443,8 @@ public:
             throw std::runtime_error("Element does not exist");
         }
         
-        auto vertices = partialOrder.GetAllVertices();
-        
-        for (int i = 0; i < vertices->GetLength(); i++) {
-            T other = vertices->Get(i);
-            if (other != element && partialOrder.HasEdge(element, other)) 
-            {
-                delete vertices;
-                return false;
-            }
-        }
-        
-        delete vertices;
-        return true;
+        int selfLoop = partialOrder.HasEdge(element, element) ? 1 : 0;
+        return partialOrder.OutDegree(element) == selfLoop;
     }
     
     // Нахождение нижней грани двух элементов
@@ -413,21 +462,12 @@ public:
             return result;
         }
         
-        // Находим все общие нижние грани
-        auto* allLowerBounds = new MutableArraySequence<T>();
-        auto vertices = partialOrder.GetAllVertices();
-        
-        for (int i = 0; i < vertices->GetLength(); i++) 
-        {
-            T candidate = vertices->Get(i);
-            
-            if (IsLessOrEqual(partialOrder, candidate, a) && IsLessOrEqual(partialOrder, candidate, b)) 
-            {
-                allLowerBounds->Append(candidate);
-            }
-        }
-        
-        delete vertices;
+        // Общие нижние грани - пересечение предков a и b: два обхода по входящим рёбрам
+        Set<T>* belowA = GetAncestorVertices(partialOrder, a);
+        Set<T>* belowB = GetAncestorVertices(partialOrder, b);
+        auto* allLowerBounds = Intersect(*belowA, *belowB);
+        delete belowA;
+        delete belowB;
         
         if (allLowerBounds->GetLength() == 0) 
         {
@@ -455,21 +495,12 @@ public:
             return result;
         }
         
-        // Находим все общие верхние грани
-        auto* allUpperBounds = new MutableArraySequence<T>();
-        auto vertices = partialOrder.GetAllVertices();
-        
-        for (int i = 0; i < vertices->GetLength(); i++) 
-        {
-            T candidate = vertices->Get(i);
-            
-            if (IsLessOrEqual(partialOrder, a, candidate) && IsLessOrEqual(partialOrder, b, candidate)) 
-            {
-                allUpperBounds->Append(candidate);
-            }
-        }
-        
-        delete vertices;
+        // Общие верхние грани - пересечение потомков a и b
+        Set<T>* aboveA = GetReachableVertices(partialOrder, a);
+        Set<T>* aboveB = GetReachableVertices(partialOrder, b);
+        auto* allUpperBounds = Intersect(*aboveA, *aboveB);
+        delete aboveA;
+        delete aboveB;
         
         if (allUpperBounds->GetLength() == 0) 
         {
@@ -518,77 +549,41 @@ public:
         return true;
     }
     
-    // Получение уровней частично упорядоченного множества
-    static Sequence<Sequence<T>*>* GetLevels(const DirectedGraph<T>& partialOrder) 
+    // Получение уровней частично упорядоченного множества: уровень вершины на единицу
+    // больше наибольшего уровня её прямых предшественников, минимальные элементы - уровень 0
+    static Sequence<Sequence<T>*>* GetLevels(const CsrGraph<T>& partialOrder) 
     {
-        if (!IsPartialOrder(partialOrder)) 
+        if (!CheckAntisymmetry(partialOrder)) 
         {
             throw std::runtime_error("Graph is not a partial order");
         }
         
-        auto* levels = new MutableArraySequence<Sequence<T>*>();
-        auto vertices = partialOrder.GetAllVertices();
-        
-        // Сначала находим минимальные элементы
-        auto minimal = FindMinimalElements(partialOrder);
-        levels->Append(minimal);
-        
-        // Создаём множество уже размещённых вершин
-        Set<T> placedVertices;
-        for (int i = 0; i < minimal->GetLength(); i++) 
+        // Номер волны алгоритма Кана и есть уровень: вершина попадает в волну, когда сняты все её предшественники
+        DynamicArray<int> order;
+        DynamicArray<int> level;
+        int n = partialOrder.GetVertexCount();
+        if (TopologicalSort<T>::KahnLevels(partialOrder, order, level) != n) 
         {
-            placedVertices.Add(minimal->Get(i));
+            throw std::runtime_error("Graph is not a partial order");
         }
+        int levelCount = n > 0 ? level[order[n - 1]] + 1 : 1;
         
-        while (placedVertices.GetCount() < partialOrder.GetVertexCount()) 
+        auto* levels = new MutableArraySequence<Sequence<T>*>();
+        for (int l = 0; l < levelCount; l++) 
         {
-            auto* nextLevel = new MutableArraySequence<T>();
-            
-            // Ищем вершины, все предшественники которых уже размещены
-            for (int i = 0; i < vertices->GetLength(); i++) 
-            {
-                T vertex = vertices->Get(i);
-                
-                if (placedVertices.Contains(vertex)) continue;
-                
-                // Проверяем, все ли предшественники размещены
-                bool allPredecessorsPlaced = true;
-                auto reachable = GetReachableVertices(partialOrder, vertex);
-                
-                // Находим прямых предшественников
-                for (int j = 0; j < vertices->GetLength(); j++) 
-                {
-                    T other = vertices->Get(j);
-                    if (other != vertex && partialOrder.HasEdge(other, vertex)) 
-                    {
-                        if (!placedVertices.Contains(other)) 
-                        {
-                            allPredecessorsPlaced = false;
-                            break;
-                        }
-                    }
-                }
-                
-                delete reachable;
-                
-                if (allPredecessorsPlaced)
-                {
-                    nextLevel->Append(vertex);
-                }
-            }
-            
-            // Добавляем вершины этого уровня в множество размещённых
-            for (int i = 0; i < nextLevel->GetLength(); i++) 
-            {
-                placedVertices.Add(nextLevel->Get(i));
-            }
-            
-            levels->Append(nextLevel);
+            levels->Append(new MutableArraySequence<T>());
+        }
+        for (int u = 0; u < n; u++) 
+        {
+            static_cast<MutableArraySequence<T>*>(levels->Get(level[u]))->Append(partialOrder.GetVertex(u));
         }
-        
-        delete vertices;
         return levels;
     }
+    
+    static Sequence<Sequence<T>*>* GetLevels(const DirectedGraph<T>& partialOrder) 
+    {
+        return GetLevels(CsrGraph<T>(partialOrder));
+    }
 };
 
 #endif // PARTIAL_ORDER_H
\ No newline at end of file
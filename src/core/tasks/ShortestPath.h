@@ -4,537 +4,2175 @@
 #include "../graph/GraphBase.h"
 #include "../graph/DirectedGraph.h"
 #include "../graph/UndirectedGraph.h"
+#include "../graph/CsrGraph.h"
 #include "../structures/priority_queue.h"
 #include "../structures/Dictionary.h"
 #include "../structures/Sequence.h"
 #include "../structures/Set.h"
+#include "../structures/thread_pool.h"
+#include "../structures/deque.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <istream>
 #include <limits>
+#include <ostream>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// Рабочая память алгоритма Дейкстры на CSR-снимке, принадлежащая вызывающему коду.
+// Массивы выделяются один раз под наибольший граф, а перед каждым запуском сбрасываются
+// только вершины, затронутые предыдущим запуском, поэтому повторные запросы
+// (особенно с ранней остановкой) не выделяют память и не обходят весь граф
+class DijkstraWorkspace 
+{
+private:
+    template<typename> friend class ShortestPath;
+
+    DynamicArray<double> dist;
+    DynamicArray<int> previous;
+    DynamicArray<bool> settled;
+    DynamicArray<int> touched;      // вершины с конечным расстоянием в последнем запуске
+    int touchedCount;
+    int settledCount;
+    IndexedPriorityQueue<double> queue;
+
+    void Prepare(int vertexCount) 
+    {
+        for (int i = 0; i < touchedCount; i++) 
+        {
+            int v = touched[i];
+            dist[v] = std::numeric_limits<double>::infinity();
+            previous[v] = -1;
+            settled[v] = false;
+        }
+        touchedCount = 0;
+        settledCount = 0;
+        queue.Clear();
+
+        int oldSize = dist.GetSize();
+        if (vertexCount > oldSize) 
+        {
+            dist.Resize(vertexCount);
+            previous.Resize(vertexCount);
+            settled.Resize(vertexCount);
+            touched.Resize(vertexCount);
+            queue.Reserve(vertexCount);
+            for (int v = oldSize; v < vertexCount; v++) 
+            {
+                dist[v] = std::numeric_limits<double>::infinity();
+                previous[v] = -1;
+            }
+        }
+    }
+
+public:
+    DijkstraWorkspace() : touchedCount(0), settledCount(0) {}
+
+    explicit DijkstraWorkspace(int vertexCount) : DijkstraWorkspace() 
+    {
+        Prepare(vertexCount);
+    }
+
+    // Расстояние от источника последнего запуска (бесконечность, если вершина не достигнута)
+    double GetDistance(int index) const 
+    {
+        return dist[index];
+    }
+
+    // Индекс предыдущей вершины на кратчайшем пути или -1
+    int GetPrevious(int index) const 
+    {
+        return previous[index];
+    }
+
+    bool IsSettled(int index) const 
+    {
+        return settled[index];
+    }
+
+    // Число вершин, извлечённых из кучи в последнем запуске
+    int GetSettledCount() const 
+    {
+        return settledCount;
+    }
+
+    // Число вершин, до которых найдено конечное расстояние, и сами эти вершины
+    int GetReachedCount() const 
+    {
+        return touchedCount;
+    }
+
+    int GetReached(int i) const 
+    {
+        if (i < 0 || i >= touchedCount) throw std::out_of_range("Index out of range");
+        return touched[i];
+    }
+};
+
+// Рабочая память двунаправленного поиска: по одной DijkstraWorkspace на каждое направление
+class BidirectionalWorkspace 
+{
+private:
+    template<typename> friend class ShortestPath;
+
+    DijkstraWorkspace forward;
+    DijkstraWorkspace backward;
+
+public:
+    const DijkstraWorkspace& GetForward() const 
+    {
+        return forward;
+    }
+
+    const DijkstraWorkspace& GetBackward() const 
+    {
+        return backward;
+    }
+
+    // Суммарное число извлечённых из куч вершин в последнем запуске
+    int GetSettledCount() const 
+    {
+        return forward.GetSettledCount() + backward.GetSettledCount();
+    }
+};
+
+// Эксцентриситеты всех вершин и производные от них характеристики графа.
+// Эксцентриситет - наибольшее конечное расстояние от вершины (недостижимые вершины не учитываются)
+template<typename T>
+class GraphEccentricities 
+{
+private:
+    template<typename> friend class ShortestPath;
+    template<typename> friend class MultiSourceBFS;
+
+    DynamicArray<double> eccentricities;   // по плотным индексам CSR-снимка
+    DynamicArray<T> center;
+    DynamicArray<T> periphery;
+    double diameter;
+    double radius;
+
+    // Диаметр, радиус, центр и периферия по заполненному массиву эксцентриситетов
+    void Finish(const CsrGraph<T>& graph) 
+    {
+        int n = eccentricities.GetSize();
+        if (n == 0) return;
+        radius = std::numeric_limits<double>::infinity();
+        for (int i = 0; i < n; i++) 
+        {
+            diameter = std::max(diameter, eccentricities[i]);
+            radius = std::min(radius, eccentricities[i]);
+        }
+        for (int i = 0; i < n; i++) 
+        {
+            if (eccentricities[i] == radius) 
+            {
+                center.PushBack(graph.GetVertex(i));
+            }
+            if (eccentricities[i] == diameter) 
+            {
+                periphery.PushBack(graph.GetVertex(i));
+            }
+        }
+    }
+
+public:
+    GraphEccentricities() : diameter(0.0), radius(0.0) {}
+
+    double GetDiameter() const { return diameter; }
+    double GetRadius() const { return radius; }
+
+    double GetEccentricity(int index) const 
+    {
+        if (index < 0 || index >= eccentricities.GetSize()) throw std::out_of_range("Vertex index out of range");
+        return eccentricities[index];
+    }
+
+    // Вершины с эксцентриситетом, равным радиусу
+    const DynamicArray<T>& GetCenter() const { return center; }
+
+    // Вершины с эксцентриситетом, равным диаметру
+    const DynamicArray<T>& GetPeriphery() const { return periphery; }
+};
+
+// Ограничения приближённого режима. Поиск останавливается, как только доказанные границы
+// отличаются не более чем в (1 + tolerance) раз, истёк бюджет времени или сделано maxSearches запусков.
+// Нулевые значения означают отсутствие соответствующего ограничения (tolerance = 0 - точный ответ)
+struct ApproximationOptions 
+{
+    double tolerance;
+    double timeBudgetSeconds;
+    int maxSearches;
+
+    ApproximationOptions(double tolerance = 0.0, double timeBudgetSeconds = 0.0, int maxSearches = 0) 
+        : tolerance(tolerance), timeBudgetSeconds(timeBudgetSeconds), maxSearches(maxSearches) {}
+};
+
+// Доказанные нижняя и верхняя границы величины (диаметра или радиуса)
+class DistanceBounds 
+{
+private:
+    template<typename> friend class ShortestPath;
+
+    double lower;
+    double upper;
+    int searchCount;
+
+public:
+    DistanceBounds() : lower(0.0), upper(std::numeric_limits<double>::infinity()), searchCount(0) {}
+
+    double GetLower() const { return lower; }
+    double GetUpper() const { return upper; }
+
+    // Число запусков поиска кратчайших путей, потраченных на оценку
+    int GetSearchCount() const { return searchCount; }
+
+    bool IsExact() const { return lower == upper; }
+
+    bool IsWithin(double tolerance) const 
+    {
+        return upper <= lower * (1.0 + tolerance);
+    }
+};
+
+// Границы эксцентриситетов всех вершин и полученные из них границы диаметра и радиуса
+template<typename T>
+class EccentricityBounds 
+{
+private:
+    template<typename> friend class ShortestPath;
+
+    DynamicArray<double> lower;   // по плотным индексам CSR-снимка
+    DynamicArray<double> upper;
+    DistanceBounds diameter;
+    DistanceBounds radius;
+
+public:
+    double GetLower(int index) const 
+    {
+        if (index < 0 || index >= lower.GetSize()) throw std::out_of_range("Vertex index out of range");
+        return lower[index];
+    }
+
+    double GetUpper(int index) const 
+    {
+        if (index < 0 || index >= upper.GetSize()) throw std::out_of_range("Vertex index out of range");
+        return upper[index];
+    }
+
+    const DistanceBounds& GetDiameter() const { return diameter; }
+    const DistanceBounds& GetRadius() const { return radius; }
+};
+
+// Способ релаксации в алгоритме Беллмана-Форда
+enum class BellmanFordMode 
+{
+    Rounds,           // раунды по всем дугам с ранним выходом, если раунд ничего не изменил
+    Queue,            // SPFA: очередь вершин, расстояние до которых уменьшилось
+    ParallelRounds    // раунды в стиле Якоби: каждая вершина вытягивает минимум по входящим дугам, вершины делятся между потоками
+};
+
+// Результат Беллмана-Форда по плотным индексам CSR-снимка: расстояния, дерево предшественников
+// и, если из источника достижим отрицательный цикл, вершины этого цикла в порядке обхода
+template<typename T>
+class BellmanFordResult 
+{
+private:
+    template<typename> friend class ShortestPath;
+
+    DynamicArray<double> dist;
+    DynamicArray<int> previous;
+    DynamicArray<T> negativeCycle;
+    int relaxations;
+
+public:
+    BellmanFordResult() : relaxations(0) {}
+
+    double GetDistance(int index) const 
+    {
+        if (index < 0 || index >= dist.GetSize()) throw std::out_of_range("Vertex index out of range");
+        return dist[index];
+    }
+
+    int GetPrevious(int index) const 
+    {
+        if (index < 0 || index >= previous.GetSize()) throw std::out_of_range("Vertex index out of range");
+        return previous[index];
+    }
+
+    bool HasNegativeCycle() const { return negativeCycle.GetSize() > 0; }
+
+    // Вершины цикла: из каждой есть дуга в следующую, из последней - в первую.
+    // При наличии цикла расстояния не окончательны
+    const DynamicArray<T>& GetNegativeCycle() const { return negativeCycle; }
+
+    // Число успешных релаксаций (для сравнения режимов)
+    int GetRelaxationCount() const { return relaxations; }
+};
+
+// Дерево кратчайших путей из одного источника: расстояния и предшественники по плотным индексам.
+// Путь до любой вершины восстанавливается по цепочке предшественников за O(длины пути).
+// Дерево не зависит от графа после построения и сохраняется в двоичный поток
+template<typename T>
+class ShortestPathTree 
+{
+private:
+    template<typename> friend class ShortestPath;
+
+    static const uint32_t MAGIC = 0x52545053;   // "SPTR"
+    static const uint32_t VERSION = 1;
+
+    DynamicArray<T> vertices;
+    Dictionary<T, int, IndexStorage<T>> indices;
+    DynamicArray<double> dist;
+    DynamicArray<int> previous;
+    int source;
+
+    ShortestPathTree(const CsrGraph<T>& graph, int source, DynamicArray<double>&& dist, DynamicArray<int>&& previous) 
+        : dist(std::move(dist)), previous(std::move(previous)), source(source) 
+    {
+        int n = graph.GetVertexCount();
+        vertices.Reserve(n);
+        indices.Reserve(n);
+        for (int i = 0; i < n; i++) 
+        {
+            vertices.PushBack(graph.GetVertex(i));
+            indices.Add(graph.GetVertex(i), i);
+        }
+    }
+
+    int RequireIndex(const T& vertex) const 
+    {
+        const int* index = indices.TryGet(vertex);
+        if (index == nullptr) 
+        {
+            throw std::runtime_error("Vertex does not exist");
+        }
+        return *index;
+    }
+
+public:
+    ShortestPathTree() : source(-1) {}
+
+    int GetVertexCount() const { return vertices.GetSize(); }
+
+    const T& GetSource() const 
+    {
+        if (source == -1) throw std::runtime_error("Shortest path tree is empty");
+        return vertices[source];
+    }
+
+    bool ContainsVertex(const T& vertex) const 
+    {
+        return indices.TryGet(vertex) != nullptr;
+    }
+
+    double GetDistance(const T& vertex) const 
+    {
+        return dist[RequireIndex(vertex)];
+    }
+
+    bool HasPath(const T& vertex) const 
+    {
+        return GetDistance(vertex) != std::numeric_limits<double>::infinity();
+    }
+
+    // Индекс предшественника в дереве или -1 (источник и недостижимые вершины)
+    int GetPreviousIndex(int index) const 
+    {
+        if (index < 0 || index >= previous.GetSize()) throw std::out_of_range("Vertex index out of range");
+        return previous[index];
+    }
+
+    // Путь от источника до vertex (пустая последовательность, если vertex недостижима)
+    Sequence<T>* GetPath(const T& vertex) const 
+    {
+        int target = RequireIndex(vertex);
+        if (dist[target] == std::numeric_limits<double>::infinity()) 
+        {
+            return new MutableArraySequence<T>();
+        }
+
+        int length = 0;
+        for (int current = target; current != -1; current = previous[current]) 
+        {
+            // Загруженное из файла дерево могло быть повреждено: цепочка длиннее n - это цикл
+            if (++length > previous.GetSize()) 
+            {
+                throw std::runtime_error("Shortest path tree contains a cycle");
+            }
+        }
+        DynamicArray<T> reversed(length);
+        int position = length;
+        for (int current = target; current != -1; current = previous[current]) 
+        {
+            reversed[--position] = vertices[current];
+        }
+        // Последовательность выделяется после проверки цепочки, чтобы исключение не оставляло утечку
+        auto* path = new MutableArraySequence<T>();
+        path->Reserve(length);
+        for (int i = 0; i < length; i++) 
+        {
+            path->Append(reversed[i]);
+        }
+        return path;
+    }
+
+    // Формат: заголовок (сигнатура, версия, число вершин, размер вершины, индекс источника),
+    // затем вершины, расстояния и предшественники подряд
+    void Save(std::ostream& os) const 
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "ShortestPathTree::Save requires trivially copyable vertices");
+        int n = GetVertexCount();
+        uint32_t header[5] = { MAGIC, VERSION, static_cast<uint32_t>(n), static_cast<uint32_t>(sizeof(T)), static_cast<uint32_t>(source) };
+        os.write(reinterpret_cast<const char*>(header), sizeof(header));
+        os.write(reinterpret_cast<const char*>(vertices.Data()), static_cast<std::streamsize>(n) * sizeof(T));
+        os.write(reinterpret_cast<const char*>(dist.Data()), static_cast<std::streamsize>(n) * sizeof(double));
+        os.write(reinterpret_cast<const char*>(previous.Data()), static_cast<std::streamsize>(n) * sizeof(int));
+        if (!os) 
+        {
+            throw std::runtime_error("Failed to write shortest path tree");
+        }
+    }
+
+    static ShortestPathTree Load(std::istream& is) 
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "ShortestPathTree::Load requires trivially copyable vertices");
+        uint32_t header[5] = {};
+        is.read(reinterpret_cast<char*>(header), sizeof(header));
+        if (!is || header[0] != MAGIC || header[1] != VERSION || header[3] != sizeof(T) || header[4] >= header[2]) 
+        {
+            throw std::runtime_error("Invalid shortest path tree format");
+        }
+
+        int n = static_cast<int>(header[2]);
+        ShortestPathTree result;
+        result.source = static_cast<int>(header[4]);
+        result.vertices = DynamicArray<T>(n);
+        result.dist = DynamicArray<double>(n);
+        result.previous = DynamicArray<int>(n);
+        is.read(reinterpret_cast<char*>(result.vertices.Data()), static_cast<std::streamsize>(n) * sizeof(T));
+        is.read(reinterpret_cast<char*>(result.dist.Data()), static_cast<std::streamsize>(n) * sizeof(double));
+        is.read(reinterpret_cast<char*>(result.previous.Data()), static_cast<std::streamsize>(n) * sizeof(int));
+        if (!is) 
+        {
+            throw std::runtime_error("Invalid shortest path tree format");
+        }
+        for (int i = 0; i < n; i++) 
+        {
+            if (result.previous[i] < -1 || result.previous[i] >= n) 
+            {
+                throw std::runtime_error("Invalid shortest path tree format");
+            }
+        }
+
+        result.indices.Reserve(n);
+        for (int i = 0; i < n; i++) 
+        {
+            result.indices.Add(result.vertices[i], i);
+        }
+        return result;
+    }
+
+    void SaveToFile(const std::string& path) const 
+    {
+        std::ofstream file(path, std::ios::binary);
+        if (!file) 
+        {
+            throw std::runtime_error("Cannot open file for writing");
+        }
+        Save(file);
+    }
+
+    static ShortestPathTree LoadFromFile(const std::string& path) 
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) 
+        {
+            throw std::runtime_error("Cannot open file for reading");
+        }
+        return Load(file);
+    }
+};
 
 template<typename T>
 class ShortestPath 
 {
 private:
-    // Структура для хранения информации о вершине в алгоритме Дейкстры
-    struct DijkstraNode 
+    // Начинает поиск из source: рабочая память должна быть подготовлена через Prepare
+    static void StartSearch(DijkstraWorkspace& workspace, int source, double priority) 
+    {
+        workspace.dist[source] = 0.0;
+        workspace.touched[workspace.touchedCount++] = source;
+        workspace.queue.Push(source, priority);
+    }
+
+    // Добавляет к path вершины цепочки предшественников от index до источника в прямом порядке
+    static void AppendChain(const CsrGraph<T>& graph, const DijkstraWorkspace& workspace, int index, MutableArraySequence<T>* path) 
+    {
+        DynamicArray<int> reversed;
+        for (int current = index; current != -1; current = workspace.GetPrevious(current)) 
+        {
+            reversed.PushBack(current);
+        }
+        path->Reserve(path->GetLength() + reversed.GetSize());
+        for (int i = reversed.GetSize() - 1; i >= 0; i--) 
+        {
+            path->Append(graph.GetVertex(reversed[i]));
+        }
+    }
+
+    static int RequireVertex(const CsrGraph<T>& graph, const T& vertex, const char* message) 
+    {
+        int index = graph.IndexOf(vertex);
+        if (index == -1) 
+        {
+            throw std::runtime_error(message);
+        }
+        return index;
+    }
+
+    // Переводит плотный массив расстояний в словарь по вершинам
+    static Dictionary<T, double>* ToDictionary(const CsrGraph<T>& graph, const DynamicArray<double>& dist) 
+    {
+        auto* distances = new Dictionary<T, double>();
+        for (int i = 0; i < graph.GetVertexCount(); i++) 
+        {
+            distances->Add(graph.GetVertex(i), dist[i]);
+        }
+        return distances;
+    }
+
+    static Dictionary<T, double>* ToDictionary(const CsrGraph<T>& graph, const DijkstraWorkspace& workspace) 
+    {
+        auto* distances = new Dictionary<T, double>();
+        for (int i = 0; i < graph.GetVertexCount(); i++) 
+        {
+            distances->Add(graph.GetVertex(i), workspace.GetDistance(i));
+        }
+        return distances;
+    }
+
+    // Дерево кратчайших путей по результату последнего запуска Дейкстры из startIndex
+    static ShortestPathTree<T> MakeTree(const CsrGraph<T>& graph, int startIndex, const DijkstraWorkspace& workspace) 
+    {
+        int n = graph.GetVertexCount();
+        DynamicArray<double> dist(n);
+        DynamicArray<int> previous(n);
+        for (int i = 0; i < n; i++) 
+        {
+            dist[i] = workspace.GetDistance(i);
+            previous[i] = workspace.GetPrevious(i);
+        }
+        return ShortestPathTree<T>(graph, startIndex, std::move(dist), std::move(previous));
+    }
+
+    // Эксцентриситет источника последнего запуска: наибольшее конечное расстояние
+    static double MaxFiniteDistance(const DijkstraWorkspace& workspace) 
+    {
+        double result = 0.0;
+        for (int i = 0; i < workspace.GetReachedCount(); i++) 
+        {
+            double distance = workspace.GetDistance(workspace.GetReached(i));
+            if (distance > result) 
+            {
+                result = distance;
+            }
+        }
+        return result;
+    }
+
+    // Счётчик запусков и бюджет времени приближённого режима
+    class SearchBudget 
+    {
+    private:
+        ApproximationOptions options;
+        std::chrono::steady_clock::time_point start;
+
+    public:
+        int searches;
+
+        explicit SearchBudget(const ApproximationOptions& options) 
+            : options(options), start(std::chrono::steady_clock::now()), searches(0) {}
+
+        bool IsExhausted() const 
+        {
+            if (options.maxSearches > 0 && searches >= options.maxSearches) return true;
+            if (options.timeBudgetSeconds <= 0.0) return false;
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            return elapsed.count() >= options.timeBudgetSeconds;
+        }
+
+        bool IsPreciseEnough(double lower, double upper) const 
+        {
+            return upper <= lower * (1.0 + options.tolerance);
+        }
+    };
+
+    // Полный поиск из source с учётом в бюджете; возвращает эксцентриситет source
+    static double Sweep(const CsrGraph<T>& graph, int source, DijkstraWorkspace& workspace, SearchBudget& budget) 
+    {
+        RunDijkstra(graph, source, -1, workspace);
+        budget.searches++;
+        return MaxFiniteDistance(workspace);
+    }
+
+    // Самая удалённая вершина последнего запуска
+    static int FarthestReached(const DijkstraWorkspace& workspace) 
+    {
+        int farthest = workspace.GetReached(0);
+        for (int i = 1; i < workspace.GetReachedCount(); i++) 
+        {
+            int v = workspace.GetReached(i);
+            if (workspace.GetDistance(v) > workspace.GetDistance(farthest)) 
+            {
+                farthest = v;
+            }
+        }
+        return farthest;
+    }
+
+    // Вершина в середине пути от источника последнего запуска до target
+    static int PathMiddle(const DijkstraWorkspace& workspace, int target) 
+    {
+        double half = workspace.GetDistance(target) / 2.0;
+        int middle = target;
+        while (workspace.GetPrevious(middle) != -1 && workspace.GetDistance(middle) > half) 
+        {
+            middle = workspace.GetPrevious(middle);
+        }
+        return middle;
+    }
+
+    // iFUB для одной компоненты связности неориентированного графа, содержащей root.
+    // Корень u выбирается 4-проходом: два двойных прохода от вершины наибольшей степени,
+    // u - середина последнего найденного длинного пути (у такой вершины обычно малый
+    // эксцентриситет). Затем вершины обрабатываются по убыванию расстояния от u: если все
+    // вершины дальше x уже обработаны, любые две оставшиеся находятся на расстоянии не больше 2x.
+    // Возвращает доказанную верхнюю границу диаметра компоненты, lower повышается по ходу
+    static double BoundComponentDiameter(const CsrGraph<T>& graph, int root, DynamicArray<bool>& covered, DijkstraWorkspace& workspace, SearchBudget& budget, double& lower, double otherUpper) 
+    {
+        lower = std::max(lower, Sweep(graph, root, workspace, budget));
+        if (workspace.GetReachedCount() <= 2) 
+        {
+            // В компоненте из одной-двух вершин эксцентриситет корня и есть диаметр
+            for (int i = 0; i < workspace.GetReachedCount(); i++) 
+            {
+                covered[workspace.GetReached(i)] = true;
+            }
+            return lower;
+        }
+
+        int hub = root;
+        for (int i = 0; i < workspace.GetReachedCount(); i++) 
+        {
+            int v = workspace.GetReached(i);
+            if (graph.GetDegree(v) > graph.GetDegree(hub)) 
+            {
+                hub = v;
+            }
+        }
+        int u = hub;
+        for (int pass = 0; pass < 2; pass++) 
+        {
+            lower = std::max(lower, Sweep(graph, u, workspace, budget));
+            int a = FarthestReached(workspace);
+            lower = std::max(lower, Sweep(graph, a, workspace, budget));
+            u = PathMiddle(workspace, FarthestReached(workspace));
+        }
+
+        double eccentricityU = Sweep(graph, u, workspace, budget);
+        lower = std::max(lower, eccentricityU);
+        int count = workspace.GetReachedCount();
+        DynamicArray<std::pair<double, int>> fringe(count);
+        for (int i = 0; i < count; i++) 
+        {
+            int v = workspace.GetReached(i);
+            covered[v] = true;
+            fringe[i] = std::make_pair(workspace.GetDistance(v), v);
+        }
+        std::sort(fringe.Data(), fringe.Data() + count, [](const std::pair<double, int>& x, const std::pair<double, int>& y) 
+        {
+            return x.first > y.first;
+        });
+
+        double upper = 2.0 * eccentricityU;
+        for (int i = 0; i < count; i++) 
+        {
+            upper = std::max(lower, 2.0 * fringe[i].first);
+            if (lower >= upper) break;
+            if (budget.IsExhausted() || budget.IsPreciseEnough(lower, std::max(upper, otherUpper))) return upper;
+            lower = std::max(lower, Sweep(graph, fringe[i].second, workspace, budget));
+        }
+        return std::min(upper, lower);
+    }
+
+public:
+    // Двойной проход: поиск из start, затем из самой удалённой найденной вершины.
+    // Эксцентриситет второй вершины - нижняя граница диаметра. Для связного неориентированного
+    // графа верхняя граница - удвоенный эксцентриситет start, иначе она не доказывается
+    static DistanceBounds DoubleSweepDiameter(const CsrGraph<T>& graph, int startIndex = 0) 
+    {
+        DistanceBounds result;
+        if (graph.GetVertexCount() == 0) 
+        {
+            result.upper = 0.0;
+            return result;
+        }
+
+        DijkstraWorkspace workspace(graph.GetVertexCount());
+        SearchBudget budget((ApproximationOptions()));
+        double eccentricityStart = Sweep(graph, startIndex, workspace, budget);
+        bool coversGraph = workspace.GetReachedCount() == graph.GetVertexCount();
+        result.lower = std::max(eccentricityStart, Sweep(graph, FarthestReached(workspace), workspace, budget));
+        if (!graph.IsDirected() && coversGraph) 
+        {
+            result.upper = std::max(result.lower, 2.0 * eccentricityStart);
+        }
+        result.searchCount = budget.searches;
+        return result;
+    }
+
+    // Диаметр с доказанными границами. Для неориентированного графа - iFUB по каждой
+    // компоненте связности: на графах с малым диаметром относительно числа вершин точный
+    // ответ получается за малое число поисков. Для ориентированного графа такого отсечения нет,
+    // и границы получаются перебором источников как в BoundEccentricities
+    static DistanceBounds BoundDiameter(const CsrGraph<T>& graph, const ApproximationOptions& options = ApproximationOptions()) 
+    {
+        if (graph.IsDirected()) 
+        {
+            return BoundEccentricities(graph, options).GetDiameter();
+        }
+
+        int n = graph.GetVertexCount();
+        DistanceBounds result;
+        result.upper = 0.0;
+        DijkstraWorkspace workspace(n);
+        SearchBudget budget(options);
+        DynamicArray<bool> covered(n);
+        for (int root = 0; root < n; root++) 
+        {
+            if (covered[root]) continue;
+            if (budget.IsExhausted()) 
+            {
+                // Непросмотренные компоненты могут оказаться сколь угодно длинными
+                result.upper = std::numeric_limits<double>::infinity();
+                break;
+            }
+            double componentUpper = BoundComponentDiameter(graph, root, covered, workspace, budget, result.lower, result.upper);
+            result.upper = std::max(result.upper, componentUpper);
+        }
+        result.upper = std::max(result.upper, result.lower);
+        result.searchCount = budget.searches;
+        return result;
+    }
+
+    static DistanceBounds BoundDiameter(const GraphBase<T>& graph, const ApproximationOptions& options = ApproximationOptions()) 
+    {
+        return BoundDiameter(CsrGraph<T>(graph), options);
+    }
+
+    // Границы эксцентриситетов всех вершин (BoundingDiameters, Takes и Kosters).
+    // После поиска из v с эксцентриситетом e для каждой достигнутой вершины w на расстоянии d
+    // верно max(e - d, d) <= ecc(w) <= e + d. Вершина перестаёт быть кандидатом, когда её
+    // границы не могут ни поднять диаметр, ни опустить радиус; источники выбираются поочерёдно
+    // с наибольшей верхней и наименьшей нижней границей. Для ориентированного графа неравенства
+    // не выполняются, поэтому точные значения известны только у просмотренных источников
+    static EccentricityBounds<T> BoundEccentricities(const CsrGraph<T>& graph, const ApproximationOptions& options = ApproximationOptions()) 
+    {
+        const double INF = std::numeric_limits<double>::infinity();
+        int n = graph.GetVertexCount();
+        EccentricityBounds<T> result;
+        result.lower = DynamicArray<double>(n);
+        result.upper = DynamicArray<double>(n);
+        DynamicArray<bool> candidate(n);
+        for (int v = 0; v < n; v++) 
+        {
+            result.upper[v] = INF;
+            candidate[v] = true;
+        }
+
+        DijkstraWorkspace workspace(n);
+        SearchBudget budget(options);
+        double diameterLower = 0.0;
+        double radiusUpper = INF;
+        int candidates = n;
+        bool pickHighUpper = true;
+        while (candidates > 0 && !budget.IsExhausted()) 
+        {
+            // Выбор источника: вершина с наибольшей верхней или наименьшей нижней границей,
+            // при равенстве - с наибольшей степенью
+            int source = -1;
+            for (int v = 0; v < n; v++) 
+            {
+                if (!candidate[v]) continue;
+                if (source == -1) 
+                {
+                    source = v;
+                    continue;
+                }
+                double key = pickHighUpper ? result.upper[v] : -result.lower[v];
+                double best = pickHighUpper ? result.upper[source] : -result.lower[source];
+                if (key > best || (key == best && graph.GetDegree(v) > graph.GetDegree(source))) 
+                {
+                    source = v;
+                }
+            }
+            pickHighUpper = !pickHighUpper;
+
+            double eccentricity = Sweep(graph, source, workspace, budget);
+            result.lower[source] = eccentricity;
+            result.upper[source] = eccentricity;
+            if (!graph.IsDirected()) 
+            {
+                for (int i = 0; i < workspace.GetReachedCount(); i++) 
+                {
+                    int w = workspace.GetReached(i);
+                    double d = workspace.GetDistance(w);
+                    result.lower[w] = std::max(result.lower[w], std::max(eccentricity - d, d));
+                    result.upper[w] = std::min(result.upper[w], eccentricity + d);
+                }
+            }
+
+            for (int v = 0; v < n; v++) 
+            {
+                diameterLower = std::max(diameterLower, result.lower[v]);
+                radiusUpper = std::min(radiusUpper, result.upper[v]);
+            }
+
+            // Отсечение кандидатов и границы по оставшимся
+            double diameterUpper = diameterLower;
+            double radiusLower = radiusUpper;
+            for (int v = 0; v < n; v++) 
+            {
+                if (!candidate[v]) continue;
+                bool settledBounds = result.lower[v] == result.upper[v];
+                bool cannotMatter = result.upper[v] <= diameterLower && result.lower[v] >= radiusUpper;
+                if (settledBounds || cannotMatter) 
+                {
+                    candidate[v] = false;
+                    candidates--;
+                    continue;
+                }
+                diameterUpper = std::max(diameterUpper, result.upper[v]);
+                radiusLower = std::min(radiusLower, result.lower[v]);
+            }
+
+            if (budget.IsPreciseEnough(diameterLower, diameterUpper) && budget.IsPreciseEnough(radiusLower, radiusUpper)) break;
+        }
+
+        // Итоговые границы по всем вершинам: у отсечённых верхняя граница не выше нижней границы
+        // диаметра, а нижняя не ниже верхней границы радиуса, так что они ничего не портят
+        result.diameter.lower = 0.0;
+        result.diameter.upper = 0.0;
+        result.radius.lower = n > 0 ? INF : 0.0;
+        result.radius.upper = n > 0 ? INF : 0.0;
+        for (int v = 0; v < n; v++) 
+        {
+            result.diameter.lower = std::max(result.diameter.lower, result.lower[v]);
+            result.diameter.upper = std::max(result.diameter.upper, result.upper[v]);
+            result.radius.lower = std::min(result.radius.lower, result.lower[v]);
+            result.radius.upper = std::min(result.radius.upper, result.upper[v]);
+        }
+        result.diameter.searchCount = budget.searches;
+        result.radius.searchCount = budget.searches;
+        return result;
+    }
+
+    static EccentricityBounds<T> BoundEccentricities(const GraphBase<T>& graph, const ApproximationOptions& options = ApproximationOptions()) 
+    {
+        return BoundEccentricities(CsrGraph<T>(graph), options);
+    }
+
+    // Радиус с доказанными границами (см. BoundEccentricities)
+    static DistanceBounds BoundRadius(const CsrGraph<T>& graph, const ApproximationOptions& options = ApproximationOptions()) 
+    {
+        return BoundEccentricities(graph, options).GetRadius();
+    }
+
+    static DistanceBounds BoundRadius(const GraphBase<T>& graph, const ApproximationOptions& options = ApproximationOptions()) 
+    {
+        return BoundRadius(CsrGraph<T>(graph), options);
+    }
+
+private:
+    // Основной цикл Дейкстры над уже начатым поиском (источники положены в кучу через StartSearch).
+    // stop(u) вызывается после извлечения u из кучи и завершает поиск, если вернул true;
+    // onRelax(u, v) вызывается при каждом улучшении расстояния до v через u.
+    // Оба функтора - параметры шаблона, поэтому пустые проверки встраиваются и ничего не стоят
+    template<typename Stop, typename OnRelax>
+    static void RunDijkstraLoop(const CsrGraph<T>& graph, DijkstraWorkspace& workspace, Stop stop, OnRelax onRelax) 
+    {
+        double* dist = workspace.dist.Data();
+        int* previous = workspace.previous.Data();
+        bool* settled = workspace.settled.Data();
+        int* touched = workspace.touched.Data();
+        IndexedPriorityQueue<double>& queue = workspace.queue;
+    
+        while (!queue.IsEmpty()) 
+        {
+            int u = queue.Pop();
+            settled[u] = true;
+            workspace.settledCount++;
+            if (stop(u)) break;
+    
+            auto neighbors = graph.GetNeighbors(u);
+            for (int i = 0; i < neighbors.GetCount(); i++) 
+            {
+                int v = neighbors.Target(i);
+                if (settled[v]) continue;
+    
+                double alt = dist[u] + neighbors.Weight(i);
+                if (alt < dist[v]) 
+                {
+                    if (dist[v] == std::numeric_limits<double>::infinity()) 
+                    {
+                        touched[workspace.touchedCount++] = v;
+                    }
+                    dist[v] = alt;
+                    previous[v] = u;
+                    onRelax(u, v);
+                    queue.PushOrDecrease(v, alt);
+                }
+            }
+        }
+    }
+
+public:
+    // Дейкстра на индексированной 4-арной куче по плотным индексам CSR-снимка.
+    // Результат (расстояния, предшественники, число извлечённых вершин) остаётся в workspace.
+    // Если endIndex != -1, поиск останавливается сразу после извлечения этой вершины из кучи:
+    // её расстояние уже окончательное. Возвращает расстояние до endIndex (или 0 без цели)
+    static double RunDijkstra(const CsrGraph<T>& graph, int startIndex, int endIndex, DijkstraWorkspace& workspace) 
+    {
+        int n = graph.GetVertexCount();
+        if (startIndex < 0 || startIndex >= n || endIndex < -1 || endIndex >= n) 
+        {
+            throw std::out_of_range("Vertex index out of range");
+        }
+        workspace.Prepare(n);
+        StartSearch(workspace, startIndex, 0.0);
+        RunDijkstraLoop(graph, workspace, [endIndex](int u) { return u == endIndex; }, [](int, int) {});
+        return endIndex == -1 ? 0.0 : workspace.dist[endIndex];
+    }
+
+    // Кратчайшее расстояние между двумя вершинами с ранней остановкой
+    static double ShortestDistance(const CsrGraph<T>& graph, T startVertex, T endVertex, DijkstraWorkspace& workspace) 
+    {
+        int startIndex = graph.IndexOf(startVertex);
+        int endIndex = graph.IndexOf(endVertex);
+        if (startIndex == -1 || endIndex == -1) 
+        {
+            throw std::runtime_error("Vertices do not exist");
+        }
+        return RunDijkstra(graph, startIndex, endIndex, workspace);
+    }
+
+    // Алгоритм Дейкстры для взвешенного графа
+    static Dictionary<T, double>* Dijkstra(const CsrGraph<T>& graph, T startVertex, DijkstraWorkspace& workspace) 
+    {
+        int startIndex = RequireVertex(graph, startVertex, "Start vertex does not exist");
+        RunDijkstra(graph, startIndex, -1, workspace);
+        return ToDictionary(graph, workspace);
+    }
+
+    static Dictionary<T, double>* Dijkstra(const CsrGraph<T>& graph, T startVertex) 
+    {
+        DijkstraWorkspace workspace;
+        return Dijkstra(graph, startVertex, workspace);
+    }
+
+    static Dictionary<T, double>* Dijkstra(const GraphBase<T>& graph, T startVertex) 
+    {
+        if (!graph.HasVertex(startVertex)) 
+        {
+            throw std::runtime_error("Start vertex does not exist");
+        }
+        return Dijkstra(CsrGraph<T>(graph), startVertex);
+    }
+    
+    // Дерево кратчайших путей Дейкстры: пути до любых вершин без повторного поиска
+    static ShortestPathTree<T> DijkstraTree(const CsrGraph<T>& graph, T startVertex, DijkstraWorkspace& workspace) 
+    {
+        int startIndex = RequireVertex(graph, startVertex, "Start vertex does not exist");
+        RunDijkstra(graph, startIndex, -1, workspace);
+        return MakeTree(graph, startIndex, workspace);
+    }
+
+    static ShortestPathTree<T> DijkstraTree(const CsrGraph<T>& graph, T startVertex) 
+    {
+        DijkstraWorkspace workspace;
+        return DijkstraTree(graph, startVertex, workspace);
+    }
+
+    static ShortestPathTree<T> DijkstraTree(const GraphBase<T>& graph, T startVertex) 
     {
-        T vertex;
-        double distance;
-        
-        DijkstraNode() : vertex(T()), distance(0.0) {}
-        DijkstraNode(T v, double d) : vertex(v), distance(d) {}
-        
-        bool operator<(const DijkstraNode& other) const 
+        if (!graph.HasVertex(startVertex)) 
         {
-            return distance > other.distance;
+            throw std::runtime_error("Start vertex does not exist");
         }
+        return DijkstraTree(CsrGraph<T>(graph), startVertex);
+    }
+    
+    // Алгоритм Дейкстры с восстановлением пути
+    static Sequence<T>* DijkstraWithPath(const CsrGraph<T>& graph, T startVertex, T endVertex, DijkstraWorkspace& workspace) 
+    {
+        double distance = ShortestDistance(graph, startVertex, endVertex, workspace);
+        auto* path = new MutableArraySequence<T>();
         
-        bool operator>(const DijkstraNode& other) const 
+        // Если конечная вершина недостижима
+        if (distance == std::numeric_limits<double>::infinity()) 
         {
-            return distance < other.distance;
+            return path;
         }
-    };
+    
+        AppendChain(graph, workspace, graph.IndexOf(endVertex), path);
+        return path;
+    }
 
-public:
-    // Алгоритм Дейкстры для взвешенного графа
-    static Dictionary<T, double>* Dijkstra(const GraphBase<T>& graph, T startVertex) 
+    static Sequence<T>* DijkstraWithPath(const CsrGraph<T>& graph, T startVertex, T endVertex) 
     {
-        if (!graph.HasVertex(startVertex)) 
-        {
-            throw std::runtime_error("Start vertex does not exist");
+        DijkstraWorkspace workspace;
+        return DijkstraWithPath(graph, startVertex, endVertex, workspace);
+    }
+
+    static Sequence<T>* DijkstraWithPath(const GraphBase<T>& graph, T startVertex, T endVertex) 
+    {
+        if (!graph.HasVertex(startVertex) || !graph.HasVertex(endVertex)) {
+            throw std::runtime_error("Vertices do not exist");
         }
+        return DijkstraWithPath(CsrGraph<T>(graph), startVertex, endVertex);
+    }
     
-        auto* distances = new Dictionary<T, double>();
-        auto vertices = graph.GetAllVertices();
-    
-        for (int i = 0; i < vertices->GetLength(); i++) 
+    // Пакет запросов расстояний по плотным индексам: results[i] = dist(sources[i], targets[i]).
+    // Запросы группируются по источнику сортировкой подсчётом, поэтому из каждого источника
+    // выполняется один поиск, который останавливается, как только извлечены все его цели.
+    // Группы распределяются по потокам пула; рабочая память и метки целей у каждого потока свои
+    // и переиспользуются между группами без полной очистки
+    static void RunBatchDistances(const CsrGraph<T>& graph, const DynamicArray<int>& sources, const DynamicArray<int>& targets, double* results, ThreadPool& pool) 
+    {
+        int n = graph.GetVertexCount();
+        int count = sources.GetSize();
+        if (targets.GetSize() != count) 
+        {
+            throw std::invalid_argument("Sources and targets must have the same length");
+        }
+        for (int i = 0; i < count; i++) 
+        {
+            if (sources[i] < 0 || sources[i] >= n || targets[i] < 0 || targets[i] >= n) 
+            {
+                throw std::out_of_range("Vertex index out of range");
+            }
+        }
+        if (count == 0) return;
+
+        // offsets[s]..offsets[s + 1] - позиции запросов источника s в order
+        DynamicArray<int> offsets(n + 1);
+        for (int i = 0; i < count; i++) 
+        {
+            offsets[sources[i] + 1]++;
+        }
+        for (int v = 0; v < n; v++) 
+        {
+            offsets[v + 1] += offsets[v];
+        }
+        DynamicArray<int> order(count);
+        DynamicArray<int> position(n);
+        DynamicArray<int> groups;
+        for (int v = 0; v < n; v++) 
+        {
+            position[v] = offsets[v];
+            if (offsets[v + 1] > offsets[v]) groups.PushBack(v);
+        }
+        for (int i = 0; i < count; i++) 
+        {
+            order[position[sources[i]]++] = i;
+        }
+
+        int threads = pool.GetThreadCount();
+        DynamicArray<DijkstraWorkspace> workspaces(threads);
+        DynamicArray<DynamicArray<int>> targetStamps(threads);
+        pool.ParallelFor(0, groups.GetSize(), [&](int g, int worker) 
+        {
+            int source = groups[g];
+            DijkstraWorkspace& workspace = workspaces[worker];
+            DynamicArray<int>& stamp = targetStamps[worker];
+            if (stamp.GetSize() < n) 
+            {
+                stamp = DynamicArray<int>(n);
+            }
+
+            // Отметка g + 1 отличает цели этой группы от целей предыдущих групп потока
+            int remaining = 0;
+            for (int k = offsets[source]; k < offsets[source + 1]; k++) 
+            {
+                int target = targets[order[k]];
+                if (stamp[target] != g + 1) 
+                {
+                    stamp[target] = g + 1;
+                    remaining++;
+                }
+            }
+
+            workspace.Prepare(n);
+            StartSearch(workspace, source, 0.0);
+            RunDijkstraLoop(graph, workspace, [&](int u) 
+            {
+                return stamp[u] == g + 1 && --remaining == 0;
+            }, [](int, int) {});
+
+            for (int k = offsets[source]; k < offsets[source + 1]; k++) 
+            {
+                results[order[k]] = workspace.GetDistance(targets[order[k]]);
+            }
+        }, 1);
+    }
+
+    // Пакет запросов (начало, конец) по вершинам; results должен вмещать queries.GetSize() значений
+    static void BatchDistances(const CsrGraph<T>& graph, const DynamicArray<std::pair<T, T>>& queries, double* results, ThreadPool& pool) 
+    {
+        DynamicArray<int> sources(queries.GetSize());
+        DynamicArray<int> targets(queries.GetSize());
+        for (int i = 0; i < queries.GetSize(); i++) 
+        {
+            sources[i] = graph.IndexOf(queries[i].first);
+            targets[i] = graph.IndexOf(queries[i].second);
+            if (sources[i] == -1 || targets[i] == -1) 
+            {
+                throw std::runtime_error("Vertices do not exist");
+            }
+        }
+        RunBatchDistances(graph, sources, targets, results, pool);
+    }
+
+    static void BatchDistances(const CsrGraph<T>& graph, const DynamicArray<std::pair<T, T>>& queries, double* results) 
+    {
+        BatchDistances(graph, queries, results, ThreadPool::Shared());
+    }
+
+    // Дейкстра из нескольких источников сразу (виртуальный общий источник с дугами нулевого веса).
+    // dist[v] - расстояние до ближайшего источника, nearest[v] - номер этого источника в sources
+    // или -1, если ни один источник не достигает v. Оба массива на GetVertexCount() значений
+    // выделяет вызывающий код; nearest может быть nullptr. Предшественники остаются в workspace
+    static void RunMultiSourceDijkstra(const CsrGraph<T>& graph, const DynamicArray<int>& sources, DijkstraWorkspace& workspace, double* dist, int* nearest = nullptr) 
+    {
+        int n = graph.GetVertexCount();
+        for (int i = 0; i < sources.GetSize(); i++) 
+        {
+            if (sources[i] < 0 || sources[i] >= n) 
+            {
+                throw std::out_of_range("Vertex index out of range");
+            }
+        }
+        workspace.Prepare(n);
+        if (nearest != nullptr) 
+        {
+            for (int v = 0; v < n; v++) 
+            {
+                nearest[v] = -1;
+            }
+        }
+        for (int i = 0; i < sources.GetSize(); i++) 
+        {
+            int source = sources[i];
+            if (workspace.dist[source] == 0.0) continue;   // повторный источник
+            StartSearch(workspace, source, 0.0);
+            if (nearest != nullptr) nearest[source] = i;
+        }
+
+        if (nearest != nullptr) 
+        {
+            RunDijkstraLoop(graph, workspace, [](int) { return false; }, [nearest](int u, int v) { nearest[v] = nearest[u]; });
+        }
+        else 
+        {
+            RunDijkstraLoop(graph, workspace, [](int) { return false; }, [](int, int) {});
+        }
+        for (int v = 0; v < n; v++) 
         {
-            T vertex = vertices->Get(i);
-            distances->Add(vertex, std::numeric_limits<double>::infinity());
+            dist[v] = workspace.dist[v];
         }
-        distances->Add(startVertex, 0.0);
+    }
+
+    // Ближайший источник по вершинам: dist и nearest индексируются плотными индексами снимка
+    static void MultiSourceDijkstra(const CsrGraph<T>& graph, const DynamicArray<T>& sources, double* dist, int* nearest = nullptr) 
+    {
+        DynamicArray<int> indices(sources.GetSize());
+        for (int i = 0; i < sources.GetSize(); i++) 
+        {
+            indices[i] = RequireVertex(graph, sources[i], "Start vertex does not exist");
+        }
+        DijkstraWorkspace workspace;
+        RunMultiSourceDijkstra(graph, indices, workspace, dist, nearest);
+    }
     
-        Set<T> visited;
-        int totalVertices = graph.GetVertexCount();
-        
-        for (int count = 0; count < totalVertices; count++) 
-        {
-            // Находим вершину с минимальным расстоянием среди непосещённых
-            T u;
-            double minDist = std::numeric_limits<double>::infinity();
-            bool found = false;
-            
-            auto allVerts = graph.GetAllVertices();
-            for (int i = 0; i < allVerts->GetLength(); i++) 
-            {
-                T vertex = allVerts->Get(i);
-                if (!visited.Contains(vertex)) 
+private:
+    // Ищет цикл в графе предшественников (каждая вершина ссылается на previous[v]).
+    // Каждая вершина проходится один раз: обход идёт по цепочке, пока не встретит вершину
+    // из более раннего обхода (цикла нет) или из текущего (найден цикл). Возвращает вершину цикла или -1
+    static int FindParentCycle(const DynamicArray<int>& previous, DynamicArray<int>& walkStamp) 
+    {
+        int n = previous.GetSize();
+        for (int v = 0; v < n; v++) 
+        {
+            walkStamp[v] = 0;
+        }
+        for (int v = 0; v < n; v++) 
+        {
+            if (walkStamp[v] != 0) continue;
+            int x = v;
+            while (x != -1 && walkStamp[x] == 0) 
+            {
+                walkStamp[x] = v + 1;
+                x = previous[x];
+            }
+            if (x != -1 && walkStamp[x] == v + 1) 
+            {
+                return x;
+            }
+        }
+        return -1;
+    }
+
+    // Записывает в result цикл предшественников через вершину onCycle, если его вес отрицателен
+    static bool ExtractNegativeCycle(const CsrGraph<T>& graph, BellmanFordResult<T>& result, int onCycle) 
+    {
+        DynamicArray<int> reversed;
+        double weight = 0.0;
+        int x = onCycle;
+        do 
+        {
+            reversed.PushBack(x);
+            weight += graph.GetArcWeight(result.previous[x], x);
+            x = result.previous[x];
+        } while (x != onCycle);
+        if (!(weight < 0.0)) return false;
+
+        result.negativeCycle = DynamicArray<T>();
+        result.negativeCycle.Reserve(reversed.GetSize());
+        for (int i = reversed.GetSize() - 1; i >= 0; i--) 
+        {
+            result.negativeCycle.PushBack(graph.GetVertex(reversed[i]));
+        }
+        return true;
+    }
+
+    // Полный раунд последовательной релаксации; возвращает вершину, расстояние до которой уменьшилось, или -1
+    static int RelaxAllArcs(const CsrGraph<T>& graph, BellmanFordResult<T>& result) 
+    {
+        const double INF = std::numeric_limits<double>::infinity();
+        int lastChanged = -1;
+        for (int from = 0; from < graph.GetVertexCount(); from++) 
+        {
+            if (result.dist[from] == INF) continue;
+            auto neighbors = graph.GetNeighbors(from);
+            for (int k = 0; k < neighbors.GetCount(); k++) 
+            {
+                int to = neighbors.Target(k);
+                double newDist = result.dist[from] + neighbors.Weight(k);
+                if (newDist < result.dist[to]) 
+                {
+                    result.dist[to] = newDist;
+                    result.previous[to] = from;
+                    result.relaxations++;
+                    lastChanged = to;
+                }
+            }
+        }
+        return lastChanged;
+    }
+
+    // Отрицательный цикл точно достижим, но в графе предшественников его пока нет:
+    // ещё V раундов релаксации, после которых цепочка предшественников вершины, изменённой
+    // в последнем раунде, за V шагов приводит на цикл
+    static void ExtractCycleByRounds(const CsrGraph<T>& graph, BellmanFordResult<T>& result) 
+    {
+        int n = graph.GetVertexCount();
+        int changed = -1;
+        for (int round = 0; round < n; round++) 
+        {
+            int last = RelaxAllArcs(graph, result);
+            if (last == -1) return;
+            changed = last;
+        }
+        for (int step = 0; step < n; step++) 
+        {
+            changed = result.previous[changed];
+        }
+        if (!ExtractNegativeCycle(graph, result, changed)) 
+        {
+            throw std::runtime_error("Graph contains negative cycle");
+        }
+    }
+
+    static bool TryParentCycle(const CsrGraph<T>& graph, BellmanFordResult<T>& result, DynamicArray<int>& walkStamp) 
+    {
+        int onCycle = FindParentCycle(result.previous, walkStamp);
+        return onCycle != -1 && ExtractNegativeCycle(graph, result, onCycle);
+    }
+
+public:
+    // Беллман-Форд на плотных массивах. Отрицательный цикл ищется рано: после каждого раунда
+    // (в режиме очереди - после каждых V релаксаций) граф предшественников проверяется на цикл
+    // за O(V); найденный цикл отрицательного веса возвращается в результате, а не исключением
+    static BellmanFordResult<T> RunBellmanFord(const CsrGraph<T>& graph, int startIndex, BellmanFordMode mode = BellmanFordMode::Queue, ThreadPool& pool = ThreadPool::Shared()) 
+    {
+        const double INF = std::numeric_limits<double>::infinity();
+        int n = graph.GetVertexCount();
+        if (startIndex < 0 || startIndex >= n) 
+        {
+            throw std::out_of_range("Vertex index out of range");
+        }
+
+        BellmanFordResult<T> result;
+        result.dist = DynamicArray<double>(n);
+        result.previous = DynamicArray<int>(n);
+        for (int v = 0; v < n; v++) 
+        {
+            result.dist[v] = INF;
+            result.previous[v] = -1;
+        }
+        result.dist[startIndex] = 0.0;
+        DynamicArray<int> walkStamp(n);
+
+        if (mode == BellmanFordMode::Queue) 
+        {
+            // SPFA: длина пути в дугах >= V означает цикл, проверка графа предшественников - раз в V релаксаций
+            Deque<int> queue(n);
+            DynamicArray<bool> queued(n);
+            DynamicArray<int> pathLength(n);
+            queue.PushBack(startIndex);
+            queued[startIndex] = true;
+            int sinceCheck = 0;
+            while (!queue.IsEmpty()) 
+            {
+                int from = queue.PopFront();
+                queued[from] = false;
+                auto neighbors = graph.GetNeighbors(from);
+                for (int k = 0; k < neighbors.GetCount(); k++) 
                 {
-                    double dist = distances->Get(vertex);
-                    if (dist < minDist) 
+                    int to = neighbors.Target(k);
+                    double newDist = result.dist[from] + neighbors.Weight(k);
+                    if (!(newDist < result.dist[to])) continue;
+
+                    result.dist[to] = newDist;
+                    result.previous[to] = from;
+                    result.relaxations++;
+                    pathLength[to] = pathLength[from] + 1;
+                    if (pathLength[to] >= n) 
+                    {
+                        if (!TryParentCycle(graph, result, walkStamp)) 
+                        {
+                            ExtractCycleByRounds(graph, result);
+                        }
+                        return result;
+                    }
+                    if (++sinceCheck >= n) 
+                    {
+                        sinceCheck = 0;
+                        if (TryParentCycle(graph, result, walkStamp)) return result;
+                    }
+                    if (!queued[to]) 
                     {
-                        minDist = dist;
-                        u = vertex;
-                        found = true;
+                        queued[to] = true;
+                        queue.PushBack(to);
                     }
                 }
             }
-            delete allVerts;
-            
-            if (!found || minDist == std::numeric_limits<double>::infinity()) 
+            return result;
+        }
+
+        if (mode == BellmanFordMode::Rounds) 
+        {
+            for (int round = 0; round < n - 1; round++) 
+            {
+                if (RelaxAllArcs(graph, result) == -1) return result;
+                if (TryParentCycle(graph, result, walkStamp)) return result;
+            }
+        }
+        else 
+        {
+            // Якоби: новое расстояние вершины считается только по расстояниям прошлого раунда,
+            // поэтому каждая вершина пишется одним потоком и блокировки не нужны
+            CsrGraph<T> reverse = graph.Transpose();
+            DynamicArray<double> next(n);
+            DynamicArray<int> changedBy(pool.GetThreadCount());
+            for (int round = 0; round < n - 1; round++) 
             {
-                break;
+                for (int w = 0; w < changedBy.GetSize(); w++) 
+                {
+                    changedBy[w] = 0;
+                }
+                pool.ParallelFor(0, n, [&](int v, int worker) 
+                {
+                    double best = result.dist[v];
+                    int parent = result.previous[v];
+                    auto incoming = reverse.GetNeighbors(v);
+                    for (int k = 0; k < incoming.GetCount(); k++) 
+                    {
+                        int from = incoming.Target(k);
+                        if (result.dist[from] == INF) continue;
+                        double candidate = result.dist[from] + incoming.Weight(k);
+                        if (candidate < best) 
+                        {
+                            best = candidate;
+                            parent = from;
+                        }
+                    }
+                    next[v] = best;
+                    if (best < result.dist[v]) 
+                    {
+                        result.previous[v] = parent;
+                        changedBy[worker]++;
+                    }
+                });
+                int changed = 0;
+                for (int w = 0; w < changedBy.GetSize(); w++) 
+                {
+                    changed += changedBy[w];
+                }
+                std::swap(result.dist, next);
+                result.relaxations += changed;
+                if (changed == 0) return result;
+                if (TryParentCycle(graph, result, walkStamp)) return result;
+            }
+        }
+
+        // V - 1 раундов пройдено: если что-то ещё улучшается, цикл есть
+        if (RelaxAllArcs(graph, result) != -1 && !TryParentCycle(graph, result, walkStamp)) 
+        {
+            ExtractCycleByRounds(graph, result);
+        }
+        return result;
+    }
+
+    // Алгоритм Беллмана-Форда для графов с отрицательными весами
+    static Dictionary<T, double>* BellmanFord(const CsrGraph<T>& graph, T startVertex, BellmanFordMode mode = BellmanFordMode::Queue) 
+    {
+        int startIndex = RequireVertex(graph, startVertex, "Start vertex does not exist");
+        BellmanFordResult<T> result = RunBellmanFord(graph, startIndex, mode);
+        if (result.HasNegativeCycle()) 
+        {
+            throw std::runtime_error("Graph contains negative cycle");
+        }
+        return ToDictionary(graph, result.dist);
+    }
+
+    // Дерево кратчайших путей Беллмана-Форда; при достижимом отрицательном цикле дерева нет
+    static ShortestPathTree<T> BellmanFordTree(const CsrGraph<T>& graph, T startVertex, BellmanFordMode mode = BellmanFordMode::Queue) 
+    {
+        int startIndex = RequireVertex(graph, startVertex, "Start vertex does not exist");
+        BellmanFordResult<T> result = RunBellmanFord(graph, startIndex, mode);
+        if (result.HasNegativeCycle()) 
+        {
+            throw std::runtime_error("Graph contains negative cycle");
+        }
+        return ShortestPathTree<T>(graph, startIndex, std::move(result.dist), std::move(result.previous));
+    }
+
+    static ShortestPathTree<T> BellmanFordTree(const DirectedGraph<T>& graph, T startVertex) 
+    {
+        if (!graph.HasVertex(startVertex)) 
+        {
+            throw std::runtime_error("Start vertex does not exist");
+        }
+        return BellmanFordTree(CsrGraph<T>(graph), startVertex);
+    }
+
+    // Отрицательный цикл, достижимый из startVertex (пустая последовательность, если его нет)
+    static Sequence<T>* FindNegativeCycle(const CsrGraph<T>& graph, T startVertex, BellmanFordMode mode = BellmanFordMode::Queue) 
+    {
+        int startIndex = RequireVertex(graph, startVertex, "Start vertex does not exist");
+        BellmanFordResult<T> result = RunBellmanFord(graph, startIndex, mode);
+        return new MutableArraySequence<T>(result.GetNegativeCycle());
+    }
+
+    static Sequence<T>* FindNegativeCycle(const DirectedGraph<T>& graph, T startVertex) 
+    {
+        if (!graph.HasVertex(startVertex)) 
+        {
+            throw std::runtime_error("Start vertex does not exist");
+        }
+        return FindNegativeCycle(CsrGraph<T>(graph), startVertex);
+    }
+
+    static Dictionary<T, double>* BellmanFord(const DirectedGraph<T>& graph, T startVertex) 
+    {
+        if (!graph.HasVertex(startVertex)) 
+        {
+            throw std::runtime_error("Start vertex does not exist");
+        }
+        return BellmanFord(CsrGraph<T>(graph), startVertex);
+    }
+    
+    // BFS по плотным индексам: расстояния в числе рёбер и предшественники в дереве обхода
+    static void RunBFS(const CsrGraph<T>& graph, int startIndex, DynamicArray<double>& dist, DynamicArray<int>& previous) 
+    {
+        int n = graph.GetVertexCount();
+        dist = DynamicArray<double>(n);
+        previous = DynamicArray<int>(n);
+        for (int i = 0; i < n; i++) 
+        {
+            dist[i] = std::numeric_limits<double>::infinity();
+            previous[i] = -1;
+        }
+        dist[startIndex] = 0.0;
+    
+        // Каждая вершина попадает в очередь один раз, поэтому хватает массива на n элементов
+        DynamicArray<int> queue(n);
+        int head = 0;
+        int tail = 0;
+        queue[tail++] = startIndex;
+    
+        while (head < tail) 
+        {
+            int current = queue[head++];
+            auto neighbors = graph.GetNeighbors(current);
+            for (int neighbor : neighbors) 
+            {
+                // Если вершина ещё не посещена
+                if (dist[neighbor] == std::numeric_limits<double>::infinity()) 
+                {
+                    dist[neighbor] = dist[current] + 1.0;
+                    previous[neighbor] = current;
+                    queue[tail++] = neighbor;
+                }
             }
-            
-            visited.Add(u);
-            
-            // Обновляем расстояния до соседей
-            auto adj = graph.GetAdjacentVertices(u);
-            for (int i = 0; i < adj->GetLength(); i++) 
+        }
+    }
+
+    // BFS для ненагруженного графа
+    static Dictionary<T, double>* BFSShortestPath(const CsrGraph<T>& graph, T startVertex) 
+    {
+        int startIndex = RequireVertex(graph, startVertex, "Start vertex does not exist");
+        DynamicArray<double> dist;
+        DynamicArray<int> previous;
+        RunBFS(graph, startIndex, dist, previous);
+        return ToDictionary(graph, dist);
+    }
+
+    static ShortestPathTree<T> BFSTree(const CsrGraph<T>& graph, T startVertex) 
+    {
+        int startIndex = RequireVertex(graph, startVertex, "Start vertex does not exist");
+        DynamicArray<double> dist;
+        DynamicArray<int> previous;
+        RunBFS(graph, startIndex, dist, previous);
+        return ShortestPathTree<T>(graph, startIndex, std::move(dist), std::move(previous));
+    }
+
+    static ShortestPathTree<T> BFSTree(const GraphBase<T>& graph, T startVertex) 
+    {
+        if (!graph.HasVertex(startVertex)) 
+        {
+            throw std::runtime_error("Start vertex does not exist");
+        }
+        return BFSTree(CsrGraph<T>(graph), startVertex);
+    }
+
+    static Dictionary<T, double>* BFSShortestPath(const GraphBase<T>& graph, T startVertex) 
+    {
+        if (!graph.HasVertex(startVertex)) 
+        {
+            throw std::runtime_error("Start vertex does not exist");
+        }
+        return BFSShortestPath(CsrGraph<T>(graph), startVertex);
+    }
+    
+    // Восстанавливает путь только по словарю расстояний (когда дерева предшественников нет).
+    // Ребро (u, v) считается лежащим на кратчайшем пути, если dist[u] + w совпадает с dist[v]
+    // с относительной точностью tolerance: точное сравнение ломается на накопленном округлении.
+    // BFS от начала по таким рёбрам за O(V + E) находит путь и при рёбрах нулевого веса.
+    // Если дерево нужно для многих запросов, дешевле построить его сразу (DijkstraTree и др.)
+    static Sequence<T>* ReconstructPath(const GraphBase<T>& graph, T startVertex, T endVertex, const Dictionary<T, double>& distances, double tolerance = 1e-9) 
+    {
+        if (!graph.HasVertex(startVertex) || !graph.HasVertex(endVertex)) 
+        {
+            throw std::runtime_error("Vertices do not exist");
+        }
+    
+        // Проверяем, достижима ли конечная вершина
+        double endDist = distances.Get(endVertex);
+        if (endDist == std::numeric_limits<double>::infinity() || endDist < 0) 
+        {
+            return new MutableArraySequence<T>();
+        }
+    
+        CsrGraph<T> csr(graph);
+        int n = csr.GetVertexCount();
+        int startIndex = csr.IndexOf(startVertex);
+        int endIndex = csr.IndexOf(endVertex);
+        DynamicArray<double> dist(n);
+        for (int i = 0; i < n; i++) 
+        {
+            const double* known = distances.TryGet(csr.GetVertex(i));
+            dist[i] = known != nullptr ? *known : std::numeric_limits<double>::infinity();
+        }
+    
+        DynamicArray<int> previous(n);
+        DynamicArray<bool> visited(n);
+        DynamicArray<int> queue(n);
+        int head = 0;
+        int tail = 0;
+        queue[tail++] = startIndex;
+        visited[startIndex] = true;
+        previous[startIndex] = -1;
+        while (head < tail && !visited[endIndex]) 
+        {
+            int u = queue[head++];
+            if (dist[u] == std::numeric_limits<double>::infinity()) continue;
+            auto neighbors = csr.GetNeighbors(u);
+            for (int k = 0; k < neighbors.GetCount(); k++) 
             {
-                T v = adj->Get(i);
-                if (!visited.Contains(v)) 
+                int v = neighbors.Target(k);
+                if (visited[v]) continue;
+                double expected = dist[u] + neighbors.Weight(k);
+                double scale = std::max(1.0, std::max(std::abs(expected), std::abs(dist[v])));
+                if (std::abs(expected - dist[v]) <= tolerance * scale) 
                 {
-                    double edgeWeight = graph.GetEdgeWeight(u, v);
-                    double alt = distances->Get(u) + edgeWeight;
-                    if (alt < distances->Get(v)) 
-                    {
-                        distances->Add(v, alt);
-                    }
+                    visited[v] = true;
+                    previous[v] = u;
+                    queue[tail++] = v;
                 }
             }
-            delete adj;
         }
     
-        delete vertices;
-        return distances;
+        if (!visited[endIndex]) 
+        {
+            throw std::runtime_error("Cannot reconstruct path");
+        }
+    
+        DynamicArray<int> reversed;
+        for (int current = endIndex; current != -1; current = previous[current]) 
+        {
+            reversed.PushBack(current);
+        }
+        auto* path = new MutableArraySequence<T>();
+        path->Reserve(reversed.GetSize());
+        for (int i = reversed.GetSize() - 1; i >= 0; i--) 
+        {
+            path->Append(csr.GetVertex(reversed[i]));
+        }
+        return path;
     }
     
-    // Алгоритм Дейкстры с восстановлением пути
-    static Sequence<T>* DijkstraWithPath(const GraphBase<T>& graph, T startVertex, T endVertex) 
+    // Двунаправленная Дейкстра: поиск одновременно от начала по graph и от конца по reverse
+    // (транспонированному снимку, для неориентированного графа - тому же graph).
+    // Каждый шаг продвигает направление с меньшей кучей; поиск заканчивается, когда сумма
+    // минимумов куч не меньше лучшего найденного пути. meetForward/meetBackward - концы ребра,
+    // через которое проходит лучший путь. Возвращает его длину (бесконечность, если пути нет)
+    static double RunBidirectionalDijkstra(const CsrGraph<T>& graph, const CsrGraph<T>& reverse, int startIndex, int endIndex, BidirectionalWorkspace& workspace, int& meetForward, int& meetBackward) 
     {
-        if (!graph.HasVertex(startVertex) || !graph.HasVertex(endVertex)) {
-            throw std::runtime_error("Vertices do not exist");
+        int n = graph.GetVertexCount();
+        if (reverse.GetVertexCount() != n) 
+        {
+            throw std::invalid_argument("Reverse graph does not match the graph");
+        }
+        if (startIndex < 0 || startIndex >= n || endIndex < 0 || endIndex >= n) 
+        {
+            throw std::out_of_range("Vertex index out of range");
         }
     
-        auto* distances = new Dictionary<T, double>();
-        auto* previous = new Dictionary<T, T>();
-        auto vertices = graph.GetAllVertices();
+        DijkstraWorkspace& forward = workspace.forward;
+        DijkstraWorkspace& backward = workspace.backward;
+        forward.Prepare(n);
+        backward.Prepare(n);
+        StartSearch(forward, startIndex, 0.0);
+        StartSearch(backward, endIndex, 0.0);
     
-        for (int i = 0; i < vertices->GetLength(); i++) 
+        double best = std::numeric_limits<double>::infinity();
+        meetForward = -1;
+        meetBackward = -1;
+        if (startIndex == endIndex) 
         {
-            T vertex = vertices->Get(i);
-            distances->Add(vertex, std::numeric_limits<double>::infinity());
+            meetForward = startIndex;
+            meetBackward = -1;
+            return 0.0;
         }
-        distances->Add(startVertex, 0.0);
     
-        Set<T> visited;
-        int totalVertices = graph.GetVertexCount();
-        
-        for (int count = 0; count < totalVertices; count++) 
-        {
-            // Находим вершину с минимальным расстоянием среди непосещённых
-            T u;
-            double minDist = std::numeric_limits<double>::infinity();
-            bool found = false;
-            
-            auto allVerts = graph.GetAllVertices();
-            for (int i = 0; i < allVerts->GetLength(); i++) 
-            {
-                T vertex = allVerts->Get(i);
-                if (!visited.Contains(vertex)) 
+        while (!forward.queue.IsEmpty() && !backward.queue.IsEmpty()) 
+        {
+            if (forward.queue.PeekPriority() + backward.queue.PeekPriority() >= best) break;
+    
+            bool forwardStep = forward.queue.GetCount() <= backward.queue.GetCount();
+            DijkstraWorkspace& side = forwardStep ? forward : backward;
+            const DijkstraWorkspace& other = forwardStep ? backward : forward;
+            const CsrGraph<T>& sideGraph = forwardStep ? graph : reverse;
+    
+            int u = side.queue.Pop();
+            side.settled[u] = true;
+            side.settledCount++;
+    
+            auto neighbors = sideGraph.GetNeighbors(u);
+            for (int i = 0; i < neighbors.GetCount(); i++) 
+            {
+                int v = neighbors.Target(i);
+                double alt = side.dist[u] + neighbors.Weight(i);
+                if (!side.settled[v] && alt < side.dist[v]) 
                 {
-                    double dist = distances->Get(vertex);
-                    if (dist < minDist) 
+                    if (side.dist[v] == std::numeric_limits<double>::infinity()) 
                     {
-                        minDist = dist;
-                        u = vertex;
-                        found = true;
+                        side.touched[side.touchedCount++] = v;
                     }
+                    side.dist[v] = alt;
+                    side.previous[v] = u;
+                    side.queue.PushOrDecrease(v, alt);
                 }
-            }
-            delete allVerts;
-            
-            if (!found || minDist == std::numeric_limits<double>::infinity()) 
-            {
-                break;
-            }
-            
-            if (u == endVertex) 
-            {
-                break;
-            }
-            
-            visited.Add(u);
-            
-            // Обновляем расстояния до соседей
-            auto adj = graph.GetAdjacentVertices(u);
-            for (int i = 0; i < adj->GetLength(); i++) 
-            {
-                T v = adj->Get(i);
-                if (!visited.Contains(v)) 
+    
+                // Путь через ребро u - v, если другое направление уже достигло v
+                double through = alt + other.dist[v];
+                if (through < best) 
                 {
-                    double edgeWeight = graph.GetEdgeWeight(u, v);
-                    double alt = distances->Get(u) + edgeWeight;
-                    if (alt < distances->Get(v)) 
-                    {
-                        distances->Add(v, alt);
-                        previous->Add(v, u);
-                    }
+                    best = through;
+                    meetForward = forwardStep ? u : v;
+                    meetBackward = forwardStep ? v : u;
                 }
             }
-            delete adj;
         }
     
-        // Восстанавливаем путь
+        return best;
+    }
+
+    static Sequence<T>* BidirectionalDijkstra(const CsrGraph<T>& graph, const CsrGraph<T>& reverse, T startVertex, T endVertex, BidirectionalWorkspace& workspace) 
+    {
+        int startIndex = graph.IndexOf(startVertex);
+        int endIndex = graph.IndexOf(endVertex);
+        if (startIndex == -1 || endIndex == -1) 
+        {
+            throw std::runtime_error("Vertices do not exist");
+        }
+    
+        int meetForward = -1;
+        int meetBackward = -1;
+        double distance = RunBidirectionalDijkstra(graph, reverse, startIndex, endIndex, workspace, meetForward, meetBackward);
         auto* path = new MutableArraySequence<T>();
-        
-        // Если конечная вершина недостижима
-        if (distances->Get(endVertex) == std::numeric_limits<double>::infinity()) 
+        if (distance == std::numeric_limits<double>::infinity()) 
         {
-            delete distances;
-            delete previous;
-            delete vertices;
             return path;
         }
     
-        // Восстанавливаем путь от конца к началу
-        T current = endVertex;
-        while (true) {
-            path->Prepend(current);
-            if (current == startVertex) break;
-            if (!previous->ContainsKey(current)) 
-            {
-                delete path;
-                delete distances;
-                delete previous;
-                delete vertices;
-                throw std::runtime_error("Cannot reconstruct path");
-            }
-            current = previous->Get(current);
+        // Начало пути - цепочка прямого поиска, конец - цепочка обратного поиска к endVertex
+        AppendChain(graph, workspace.forward, meetForward, path);
+        for (int current = meetBackward; current != -1; current = workspace.backward.GetPrevious(current)) 
+        {
+            path->Append(graph.GetVertex(current));
         }
-    
-        delete distances;
-        delete previous;
-        delete vertices;
         return path;
     }
-    
-    // Алгоритм Беллмана-Форда для графов с отрицательными весами
-    static Dictionary<T, double>* BellmanFord(const DirectedGraph<T>& graph, T startVertex) 
+
+    static Sequence<T>* BidirectionalDijkstra(const CsrGraph<T>& graph, T startVertex, T endVertex) 
     {
-        if (!graph.HasVertex(startVertex)) 
+        BidirectionalWorkspace workspace;
+        if (!graph.IsDirected()) 
         {
-            throw std::runtime_error("Start vertex does not exist");
+            return BidirectionalDijkstra(graph, graph, startVertex, endVertex, workspace);
         }
-        
-        auto* distances = new Dictionary<T, double>();
-        auto vertices = graph.GetAllVertices();
-        
-        for (int i = 0; i < vertices->GetLength(); i++) 
+        return BidirectionalDijkstra(graph, graph.Transpose(), startVertex, endVertex, workspace);
+    }
+
+    static Sequence<T>* BidirectionalDijkstra(const GraphBase<T>& graph, T startVertex, T endVertex) 
+    {
+        if (!graph.HasVertex(startVertex) || !graph.HasVertex(endVertex)) 
+        {
+            throw std::runtime_error("Vertices do not exist");
+        }
+        return BidirectionalDijkstra(CsrGraph<T>(graph), startVertex, endVertex);
+    }
+
+    // A*: вершины извлекаются по dist + heuristic(вершина, цель). Эвристика должна быть
+    // допустимой (не больше истинного расстояния до цели); если она к тому же монотонна,
+    // каждая вершина извлекается не более одного раза, иначе вершины могут открываться повторно.
+    // Возвращает расстояние до цели (бесконечность, если цель недостижима)
+    static double RunAStar(const CsrGraph<T>& graph, int startIndex, int endIndex, const std::function<double(const T&, const T&)>& heuristic, DijkstraWorkspace& workspace) 
+    {
+        int n = graph.GetVertexCount();
+        if (startIndex < 0 || startIndex >= n || endIndex < 0 || endIndex >= n) 
         {
-            T vertex = vertices->Get(i);
-            distances->Add(vertex, std::numeric_limits<double>::infinity());
+            throw std::out_of_range("Vertex index out of range");
         }
-        distances->Add(startVertex, 0.0);
-        
-        for (int i = 0; i < graph.GetVertexCount() - 1; i++) 
+        workspace.Prepare(n);
+    
+        double* dist = workspace.dist.Data();
+        int* previous = workspace.previous.Data();
+        bool* settled = workspace.settled.Data();
+        const T& goal = graph.GetVertex(endIndex);
+        StartSearch(workspace, startIndex, heuristic(graph.GetVertex(startIndex), goal));
+    
+        while (!workspace.queue.IsEmpty()) 
         {
-            bool changed = false;
-            
-            for (int j = 0; j < vertices->GetLength(); j++) 
+            int u = workspace.queue.Pop();
+            settled[u] = true;
+            workspace.settledCount++;
+            if (u == endIndex) break;
+    
+            auto neighbors = graph.GetNeighbors(u);
+            for (int i = 0; i < neighbors.GetCount(); i++) 
             {
-                T from = vertices->Get(j);
-                auto adj = graph.GetAdjacentVertices(from);
-                
-                for (int k = 0; k < adj->GetLength(); k++) 
+                int v = neighbors.Target(i);
+                double alt = dist[u] + neighbors.Weight(i);
+                if (alt < dist[v]) 
                 {
-                    T to = adj->Get(k);
-                    double weight = graph.GetEdgeWeight(from, to);
-                    double newDist = distances->Get(from) + weight;
-                    
-                    if (distances->Get(from) < std::numeric_limits<double>::infinity() && 
-                        newDist < distances->Get(to)) 
-                        {
-                        distances->Add(to, newDist);
-                        changed = true;
+                    if (dist[v] == std::numeric_limits<double>::infinity()) 
+                    {
+                        workspace.touched[workspace.touchedCount++] = v;
                     }
-                }
-                
-                delete adj;
-            }
-            
-            if (!changed) break; 
-        }
-        
-        // Проверка на отрицательные циклы
-        for (int j = 0; j < vertices->GetLength(); j++) 
-        {
-            T from = vertices->Get(j);
-            auto adj = graph.GetAdjacentVertices(from);
-            
-            for (int k = 0; k < adj->GetLength(); k++) 
-            {
-                T to = adj->Get(k);
-                double weight = graph.GetEdgeWeight(from, to);
-                
-                if (distances->Get(from) < std::numeric_limits<double>::infinity() && distances->Get(from) + weight < distances->Get(to)) 
-                {
-                    delete vertices;
-                    delete distances;
-                    delete adj;
-                    throw std::runtime_error("Graph contains negative cycle");
+                    dist[v] = alt;
+                    previous[v] = u;
+                    settled[v] = false;
+                    workspace.queue.PushOrDecrease(v, alt + heuristic(graph.GetVertex(v), goal));
                 }
             }
-            
-            delete adj;
         }
-        
-        delete vertices;
-        return distances;
-    }
     
-    // BFS для ненагруженного графа
-    static Dictionary<T, double>* BFSShortestPath(const GraphBase<T>& graph, T startVertex) 
+        return dist[endIndex];
+    }
+
+    static Sequence<T>* AStar(const CsrGraph<T>& graph, T startVertex, T endVertex, const std::function<double(const T&, const T&)>& heuristic, DijkstraWorkspace& workspace) 
     {
-        if (!graph.HasVertex(startVertex)) 
+        int startIndex = graph.IndexOf(startVertex);
+        int endIndex = graph.IndexOf(endVertex);
+        if (startIndex == -1 || endIndex == -1) 
         {
-            throw std::runtime_error("Start vertex does not exist");
+            throw std::runtime_error("Vertices do not exist");
         }
     
-        auto* distances = new Dictionary<T, double>();
-        auto vertices = graph.GetAllVertices();
-    
-        for (int i = 0; i < vertices->GetLength(); i++) 
+        auto* path = new MutableArraySequence<T>();
+        if (RunAStar(graph, startIndex, endIndex, heuristic, workspace) == std::numeric_limits<double>::infinity()) 
         {
-            T vertex = vertices->Get(i);
-            distances->Add(vertex, std::numeric_limits<double>::infinity());
+            return path;
         }
-        distances->Add(startVertex, 0.0);
-    
-        Queue<T> queue;
-        queue.Enqueue(startVertex);
+        AppendChain(graph, workspace, endIndex, path);
+        return path;
+    }
+
+    static Sequence<T>* AStar(const CsrGraph<T>& graph, T startVertex, T endVertex, const std::function<double(const T&, const T&)>& heuristic) 
+    {
+        DijkstraWorkspace workspace;
+        return AStar(graph, startVertex, endVertex, heuristic, workspace);
+    }
+
+    static Sequence<T>* AStar(const GraphBase<T>& graph, T startVertex, T endVertex, const std::function<double(const T&, const T&)>& heuristic) 
+    {
+        if (!graph.HasVertex(startVertex) || !graph.HasVertex(endVertex)) 
+        {
+            throw std::runtime_error("Vertices do not exist");
+        }
+        return AStar(CsrGraph<T>(graph), startVertex, endVertex, heuristic);
+    }
     
-        while (!queue.IsEmpty()) 
+    // Наибольший вес дуги; отрицательные веса для дельта-шага недопустимы
+    static double MaxDeltaSteppingWeight(const CsrGraph<T>& graph) 
+    {
+        double maxWeight = 0.0;
+        for (int u = 0; u < graph.GetVertexCount(); u++) 
         {
-            T current = queue.Dequeue();
-            double currentDist = distances->Get(current);
-        
-            auto adj = graph.GetAdjacentVertices(current);
-        
-            for (int i = 0; i < adj->GetLength(); i++) 
+            auto neighbors = graph.GetNeighbors(u);
+            for (int i = 0; i < neighbors.GetCount(); i++) 
             {
-                T neighbor = adj->Get(i);
-            
-                // Если вершина ещё не посещена
-                if (distances->Get(neighbor) == std::numeric_limits<double>::infinity()) 
+                if (neighbors.Weight(i) < 0.0) 
                 {
-                    distances->Add(neighbor, currentDist + 1.0);
-                    queue.Enqueue(neighbor);
+                    throw std::runtime_error("Delta-stepping requires non-negative edge weights");
                 }
+                maxWeight = std::max(maxWeight, neighbors.Weight(i));
             }
-        
-            delete adj;
         }
-    
-        delete vertices;
-        return distances;
+        return maxWeight;
     }
-    
-    static Sequence<T>* ReconstructPath(const GraphBase<T>& graph, T startVertex, T endVertex,const Dictionary<T, double>& distances) 
+
+    // Ширина корзины для дельта-шага: наибольший вес, делённый на среднюю степень.
+    // Так в корзину попадает в среднем O(1) лёгких рёбер на вершину (оценка Мейера и Сандерса),
+    // а число корзин остаётся порядка диаметра в единицах среднего ребра
+    static double ChooseDelta(const CsrGraph<T>& graph) 
     {
-        if (!graph.HasVertex(startVertex) || !graph.HasVertex(endVertex)) 
+        double maxWeight = MaxDeltaSteppingWeight(graph);
+        if (graph.GetArcCount() == 0 || maxWeight == 0.0) return 1.0;
+        double averageDegree = static_cast<double>(graph.GetArcCount()) / graph.GetVertexCount();
+        return maxWeight / std::max(1.0, averageDegree);
+    }
+
+    // Дельта-шаг (Мейер и Сандерс): вершины раскладываются по корзинам ширины delta по текущему
+    // расстоянию. Корзины обрабатываются по возрастанию; внутри корзины лёгкие рёбра (вес <= delta)
+    // релаксируются фазами, пока корзина не опустеет, затем один раз релаксируются тяжёлые рёбра
+    // всех вершин корзины. Каждая фаза параллельна: потоки собирают запросы релаксации в свои
+    // буферы, разложенные по вершине-владельцу (v % число потоков), а затем каждый поток применяет
+    // запросы к своим вершинам, поэтому запись в dist обходится без блокировок и атомарных операций.
+    // Маленькие фазы выполняются в вызывающем потоке. delta <= 0 - подбор через ChooseDelta.
+    // Если previous не nullptr, в него записываются предшественники на кратчайших путях
+    static void RunDeltaStepping(const CsrGraph<T>& graph, int startIndex, DynamicArray<double>& dist, ThreadPool& pool, double delta = 0.0, DynamicArray<int>* previous = nullptr) 
+    {
+        // Запрос релаксации: новое расстояние до target через from
+        struct Request 
         {
-            throw std::runtime_error("Vertices do not exist");
+            int target;
+            int from;
+            double distance;
+        };
+
+        const double INF = std::numeric_limits<double>::infinity();
+        const int PARALLEL_THRESHOLD = 256;
+        int n = graph.GetVertexCount();
+        if (startIndex < 0 || startIndex >= n) 
+        {
+            throw std::out_of_range("Vertex index out of range");
         }
-    
-        // Проверяем, достижима ли конечная вершина
-        double endDist = distances.Get(endVertex);
-        if (endDist == std::numeric_limits<double>::infinity() || endDist < 0) 
+        if (!(delta > 0.0)) 
         {
-            return new MutableArraySequence<T>();
+            delta = ChooseDelta(graph);
         }
-    
-        auto* path = new MutableArraySequence<T>();
-        T current = endVertex;
-    
-        // Добавляем конечную вершину
-        path->Prepend(current);
-    
-        while (current != startVertex) 
+        // Номер корзины не превышает maxWeight * (n - 1) / delta. Слишком узкие корзины расширяются
+        // так, чтобы номер помещался в int, а корзин было O(n); на расстояния ширина не влияет
+        const double MAX_BUCKETS_PER_VERTEX = 8.0;
+        double maxDistance = MaxDeltaSteppingWeight(graph) * (n - 1);
+        delta = std::max(delta, maxDistance / (MAX_BUCKETS_PER_VERTEX * n + 1024.0));
+
+        dist = DynamicArray<double>(n);
+        for (int v = 0; v < n; v++) 
+        {
+            dist[v] = INF;
+        }
+        if (previous != nullptr) 
         {
-            bool foundPrev = false;
-            
-            // Получаем все вершины графа
-            auto allVertices = graph.GetAllVertices();
-            
-            // Ищем предыдущую вершину на кратчайшем пути
-            for (int i = 0; i < allVertices->GetLength(); i++) 
+            *previous = DynamicArray<int>(n);
+            for (int v = 0; v < n; v++) 
             {
-                T candidate = allVertices->Get(i);
-                
-                if (graph.HasEdge(candidate, current)) 
+                (*previous)[v] = -1;
+            }
+        }
+
+        int threads = pool.GetThreadCount();
+        DynamicArray<DynamicArray<Request>> requests(threads * threads);                  // [поток * threads + владелец]
+        DynamicArray<DynamicArray<int>> improved(threads);                                // по владельцу
+        DynamicArray<DynamicArray<int>> buckets;
+        DynamicArray<int> frontierStamp(n);
+        DynamicArray<int> settledStamp(n);
+        DynamicArray<int> frontier;
+        DynamicArray<int> settled;
+        int round = 0;
+
+        auto bucketOf = [delta](double distance) 
+        {
+            return static_cast<int>(distance / delta);
+        };
+        auto forEach = [&pool](int count, bool parallel, const std::function<void(int, int)>& body) 
+        {
+            if (parallel) 
+            {
+                pool.ParallelFor(0, count, body);
+                return;
+            }
+            for (int i = 0; i < count; i++) 
+            {
+                body(i, 0);
+            }
+        };
+
+        // Релаксация лёгких или тяжёлых рёбер вершин vertices и раскладка улучшенных вершин по корзинам
+        auto relax = [&](const DynamicArray<int>& vertices, bool light) 
+        {
+            bool parallel = vertices.GetSize() >= PARALLEL_THRESHOLD && threads > 1;
+            forEach(vertices.GetSize(), parallel, [&](int i, int worker) 
+            {
+                int u = vertices[i];
+                double du = dist[u];
+                auto neighbors = graph.GetNeighbors(u);
+                for (int k = 0; k < neighbors.GetCount(); k++) 
                 {
-                    double edgeWeight = graph.GetEdgeWeight(candidate, current);
-                    double candidateDist = distances.Get(candidate);
-                    
-                    if (candidateDist + edgeWeight == distances.Get(current)) 
+                    double weight = neighbors.Weight(k);
+                    if ((weight <= delta) != light) continue;
+                    int v = neighbors.Target(k);
+                    double candidate = du + weight;
+                    if (candidate < dist[v]) 
                     {
-                        path->Prepend(candidate);
-                        current = candidate;
-                        foundPrev = true;
-                        break;
+                        requests[worker * threads + v % threads].PushBack(Request{ v, u, candidate });
                     }
                 }
-            }
-            
-            delete allVertices;
-            
-            // Если не нашли среди всех вершин, пробуем среди соседей
-            if (!foundPrev) 
-            {
-                auto adj = graph.GetAdjacentVertices(current);
-                for (int i = 0; i < adj->GetLength(); i++) {
-                    T neighbor = adj->Get(i);
-                    double edgeWeight = graph.GetEdgeWeight(neighbor, current);
-                    double neighborDist = distances.Get(neighbor);
-                    
-                    if (neighborDist + edgeWeight == distances.Get(current)) {
-                        path->Prepend(neighbor);
-                        current = neighbor;
-                        foundPrev = true;
-                        break;
+            });
+            forEach(threads, parallel, [&](int owner, int) 
+            {
+                for (int worker = 0; worker < threads; worker++) 
+                {
+                    DynamicArray<Request>& batch = requests[worker * threads + owner];
+                    for (int k = 0; k < batch.GetSize(); k++) 
+                    {
+                        int v = batch[k].target;
+                        if (batch[k].distance < dist[v]) 
+                        {
+                            dist[v] = batch[k].distance;
+                            if (previous != nullptr) 
+                            {
+                                (*previous)[v] = batch[k].from;
+                            }
+                            improved[owner].PushBack(v);
+                        }
+                    }
+                    batch.Clear();
+                }
+            });
+            for (int owner = 0; owner < threads; owner++) 
+            {
+                for (int k = 0; k < improved[owner].GetSize(); k++) 
+                {
+                    int v = improved[owner][k];
+                    int bucket = bucketOf(dist[v]);
+                    if (bucket >= buckets.GetSize()) 
+                    {
+                        // Resize выделяет ровно запрошенную ёмкость, поэтому растим её геометрически:
+                        // иначе каждая новая корзина переносила бы все предыдущие
+                        if (bucket >= buckets.GetCapacity()) 
+                        {
+                            buckets.Reserve(std::max(bucket + 1, 2 * buckets.GetCapacity()));
+                        }
+                        buckets.Resize(bucket + 1);
                     }
+                    buckets[bucket].PushBack(v);
                 }
-                delete adj;
+                improved[owner].Clear();
             }
-        
-            if (!foundPrev) 
+        };
+
+        dist[startIndex] = 0.0;
+        buckets.Resize(1);
+        buckets[0].PushBack(startIndex);
+        for (int b = 0; b < buckets.GetSize(); b++) 
+        {
+            settled.Clear();
+            while (buckets[b].GetSize() > 0) 
             {
-                delete path;
-                throw std::runtime_error("Cannot reconstruct path");
+                // Выбрасываем устаревшие записи: вершина могла переехать в меньшую корзину
+                // или попасть в эту корзину несколько раз
+                round++;
+                DynamicArray<int> current = std::move(buckets[b]);
+                buckets[b] = DynamicArray<int>();
+                frontier.Clear();
+                for (int i = 0; i < current.GetSize(); i++) 
+                {
+                    int v = current[i];
+                    if (frontierStamp[v] == round || bucketOf(dist[v]) != b) continue;
+                    frontierStamp[v] = round;
+                    frontier.PushBack(v);
+                    if (settledStamp[v] != b + 1) 
+                    {
+                        settledStamp[v] = b + 1;
+                        settled.PushBack(v);
+                    }
+                }
+                relax(frontier, true);
             }
+            relax(settled, false);
         }
-    
-        return path;
+    }
+
+    static Dictionary<T, double>* DeltaStepping(const CsrGraph<T>& graph, T startVertex, ThreadPool& pool, double delta = 0.0) 
+    {
+        int start = RequireVertex(graph, startVertex, "Start vertex does not exist");
+        DynamicArray<double> dist;
+        RunDeltaStepping(graph, start, dist, pool, delta);
+        return ToDictionary(graph, dist);
+    }
+
+    static Dictionary<T, double>* DeltaStepping(const CsrGraph<T>& graph, T startVertex) 
+    {
+        return DeltaStepping(graph, startVertex, ThreadPool::Shared());
+    }
+
+    static ShortestPathTree<T> DeltaSteppingTree(const CsrGraph<T>& graph, T startVertex, ThreadPool& pool, double delta = 0.0) 
+    {
+        int start = RequireVertex(graph, startVertex, "Start vertex does not exist");
+        DynamicArray<double> dist;
+        DynamicArray<int> previous;
+        RunDeltaStepping(graph, start, dist, pool, delta, &previous);
+        return ShortestPathTree<T>(graph, start, std::move(dist), std::move(previous));
+    }
+
+    static ShortestPathTree<T> DeltaSteppingTree(const CsrGraph<T>& graph, T startVertex) 
+    {
+        return DeltaSteppingTree(graph, startVertex, ThreadPool::Shared());
+    }
+
+    static Dictionary<T, double>* DeltaStepping(const GraphBase<T>& graph, T startVertex) 
+    {
+        if (!graph.HasVertex(startVertex)) 
+        {
+            throw std::runtime_error("Start vertex does not exist");
+        }
+        return DeltaStepping(CsrGraph<T>(graph), startVertex);
     }
     
-    // Нахождение кратчайшего пути между двумя вершинами (Дейкстра + восстановление)
+    // Нахождение кратчайшего пути между двумя вершинами (двунаправленная Дейкстра)
     static Sequence<T>* FindShortestPath(const GraphBase<T>& graph, T startVertex, T endVertex) 
     {
-        // Используем DijkstraWithPath, который сразу возвращает путь
-        return DijkstraWithPath(graph, startVertex, endVertex);
+        return BidirectionalDijkstra(graph, startVertex, endVertex);
+    }
+    
+    // Эксцентриситеты всех вершин за один проход: Дейкстра из каждой вершины,
+    // источники распределяются по потокам пула, у каждого потока своя DijkstraWorkspace.
+    // Диаметр, радиус, центр и периферия собираются из общего массива эксцентриситетов
+    static GraphEccentricities<T> ComputeEccentricities(const CsrGraph<T>& graph, ThreadPool& pool) 
+    {
+        int n = graph.GetVertexCount();
+        GraphEccentricities<T> result;
+        result.eccentricities = DynamicArray<double>(n);
+        if (n == 0) return result;
+
+        DynamicArray<DijkstraWorkspace> workspaces(pool.GetThreadCount());
+        pool.ParallelFor(0, n, [&](int source, int worker) 
+        {
+            DijkstraWorkspace& workspace = workspaces[worker];
+            RunDijkstra(graph, source, -1, workspace);
+            result.eccentricities[source] = MaxFiniteDistance(workspace);
+        }, 1);
+
+        result.Finish(graph);
+        return result;
+    }
+
+    static GraphEccentricities<T> ComputeEccentricities(const CsrGraph<T>& graph) 
+    {
+        return ComputeEccentricities(graph, ThreadPool::Shared());
+    }
+
+    static GraphEccentricities<T> ComputeEccentricities(const GraphBase<T>& graph) 
+    {
+        return ComputeEccentricities(CsrGraph<T>(graph));
     }
     
     // Вычисление диаметра графа
+    static double GetGraphDiameter(const CsrGraph<T>& graph) 
+    {
+        return ComputeEccentricities(graph).GetDiameter();
+    }
+
     static double GetGraphDiameter(const GraphBase<T>& graph) 
     {
         if (graph.GetVertexCount() == 0) return 0.0;
-        
-        double maxDiameter = 0.0;
-        auto vertices = graph.GetAllVertices();
-        
-        for (int i = 0; i < vertices->GetLength(); i++) 
-        {
-            T startVertex = vertices->Get(i);
-            auto distances = Dijkstra(graph, startVertex);
-            
-            distances->ForEach([&maxDiameter](const T& vertex, double distance) 
-            {
-                if (distance < std::numeric_limits<double>::infinity() && distance > maxDiameter) 
-                {
-                    maxDiameter = distance;
-                }
-            });
-            
-            delete distances;
-        }
-        
-        delete vertices;
-        return maxDiameter;
+        return GetGraphDiameter(CsrGraph<T>(graph));
     }
     
     // Вычисление радиуса графа
+    static double GetGraphRadius(const CsrGraph<T>& graph) 
+    {
+        return ComputeEccentricities(graph).GetRadius();
+    }
+
     static double GetGraphRadius(const GraphBase<T>& graph) 
     {
         if (graph.GetVertexCount() == 0) return 0.0;
-        
-        double minRadius = std::numeric_limits<double>::infinity();
-        auto vertices = graph.GetAllVertices();
-        
-        for (int i = 0; i < vertices->GetLength(); i++) 
-        {
-            T startVertex = vertices->Get(i);
-            auto distances = Dijkstra(graph, startVertex);
-            
-            double eccentricity = 0.0;
-            distances->ForEach([&eccentricity](const T& vertex, double distance) 
-            {
-                if (distance < std::numeric_limits<double>::infinity() && distance > eccentricity) 
-                {
-                    eccentricity = distance;
-                }
-            });
-            
-            if (eccentricity < minRadius) 
-            {
-                minRadius = eccentricity;
-            }
-            
-            delete distances;
-        }
-        
-        delete vertices;
-        return (minRadius == std::numeric_limits<double>::infinity()) ? 0.0 : minRadius;
+        return GetGraphRadius(CsrGraph<T>(graph));
     }
     
     // Нахождение центра графа
+    static Sequence<T>* FindGraphCenter(const CsrGraph<T>& graph) 
+    {
+        return new MutableArraySequence<T>(ComputeEccentricities(graph).GetCenter());
+    }
+
     static Sequence<T>* FindGraphCenter(const GraphBase<T>& graph) 
     {
         if (graph.GetVertexCount() == 0) return new MutableArraySequence<T>();
-        
-        auto* centerVertices = new MutableArraySequence<T>();
-        double minEccentricity = std::numeric_limits<double>::infinity();
-        auto vertices = graph.GetAllVertices();
-        
-        Dictionary<T, double> eccentricities;
-        
-        // Вычисляем эксцентриситет для каждой вершины
-        for (int i = 0; i < vertices->GetLength(); i++) 
-        {
-            T vertex = vertices->Get(i);
-            auto distances = Dijkstra(graph, vertex);
-            
-            double eccentricity = 0.0;
-            distances->ForEach([&eccentricity](const T& v, double distance) 
-            {
-                if (distance < std::numeric_limits<double>::infinity() && distance > eccentricity) 
-                {
-                    eccentricity = distance;
-                }
-            });
-            
-            eccentricities.Add(vertex, eccentricity);
-            
-            if (eccentricity < minEccentricity) 
-            {
-                minEccentricity = eccentricity;
-            }
-            
-            delete distances;
-        }
-        
-        // Находим все вершины с минимальным эксцентриситетом
-        eccentricities.ForEach([&](const T& vertex, double eccentricity) 
-        {
-            if (eccentricity == minEccentricity) 
-            {
-                centerVertices->Append(vertex);
-            }
-        });
-        
-        delete vertices;
-        return centerVertices;
+        return FindGraphCenter(CsrGraph<T>(graph));
     }
 };
 
@@ -0,0 +1,665 @@
+#ifndef STRONGLY_CONNECTED_COMPONENTS_H
+#define STRONGLY_CONNECTED_COMPONENTS_H
+
+#include "../graph/DirectedGraph.h"
+#include "../graph/CsrGraph.h"
+#include "../structures/Sequence.h"
+#include "../structures/Dictionary.h"
+#include "../structures/thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <utility>
+
+// Конденсация ориентированного графа: каждая компонента сильной связности стянута в одну вершину.
+// Вершины DAG - номера компонент 0..k-1 в топологическом порядке (дуги ведут только от меньшего
+// номера к большему). Дуга c1 -> c2 есть, если в исходном графе есть дуга из c1 в c2;
+// её вес - наименьший из весов таких дуг. Петли и дуги внутри компонент отбрасываются
+template<typename T>
+class CondensationGraph 
+{
+private:
+    template<typename> friend class StronglyConnectedComponents;
+
+    DirectedGraph<int> dag;
+    DynamicArray<T> members;      // вершины исходного графа, сгруппированные по компонентам
+    DynamicArray<int> offsets;    // компонента c - members[offsets[c] .. offsets[c + 1])
+    Dictionary<T, int, IndexStorage<T>> componentOf;
+
+    void checkComponent(int component) const 
+    {
+        if (component < 0 || component >= GetComponentCount()) 
+        {
+            throw std::out_of_range("Component index out of range");
+        }
+    }
+
+public:
+    CondensationGraph() : offsets(1) {}
+
+    // Ациклический граф компонент: к нему применимы TopologicalSort и PartialOrder
+    const DirectedGraph<int>& GetGraph() const { return dag; }
+
+    int GetComponentCount() const { return offsets.GetSize() - 1; }
+
+    int GetComponent(const T& vertex) const 
+    {
+        const int* component = componentOf.TryGet(vertex);
+        if (component == nullptr) 
+        {
+            throw std::runtime_error("Vertex not found in graph");
+        }
+        return *component;
+    }
+
+    int GetComponentSize(int component) const 
+    {
+        checkComponent(component);
+        return offsets[component + 1] - offsets[component];
+    }
+
+    // Вершины компоненты в порядке индексов CSR-снимка
+    Sequence<T>* GetMembers(int component) const 
+    {
+        checkComponent(component);
+        auto* result = new MutableArraySequence<T>();
+        result->Reserve(GetComponentSize(component));
+        for (int i = offsets[component]; i < offsets[component + 1]; i++) 
+        {
+            result->Append(members[i]);
+        }
+        return result;
+    }
+};
+
+// Компоненты сильной связности ориентированного графа и его конденсация.
+// LabelComponents - итеративный алгоритм Тарьяна за O(V + E), LabelComponentsParallel -
+// forward-backward с предварительным отсечением тривиальных компонент и Тарьяном для мелких подзадач
+template<typename T>
+class StronglyConnectedComponents 
+{
+private:
+    // Фронт BFS короче этого порога расширяется в вызывающем потоке без обращения к пулу
+    static const int PARALLEL_FRONTIER = 1024;
+    // Подзадачи forward-backward от этого размера разбиваются по одной с параллельными обходами,
+    // меньшие раздаются пулу как отдельные задачи
+    static const int PARALLEL_SEGMENT = 65536;
+    // Подзадачи не больше этого размера, а также оставшиеся после MAX_SPLIT_DEPTH разбиений,
+    // размечаются Тарьяном: он линеен на любом графе, а разбиение мелких подзадач не окупается
+    static const int SEQUENTIAL_SEGMENT = 4096;
+    static const int MAX_SPLIT_DEPTH = 32;
+
+    // Подзадача forward-backward: отрезок [begin, end) массива вершин и число разбиений до неё
+    struct Segment 
+    {
+        int begin;
+        int end;
+        int depth;
+    };
+
+    // Перемешивание битов (финализатор MurmurHash3) для псевдослучайного выбора опорной вершины
+    static unsigned int Scramble(unsigned int x) 
+    {
+        x ^= x >> 16;
+        x *= 0x85ebca6bu;
+        x ^= x >> 13;
+        x *= 0xc2b2ae35u;
+        x ^= x >> 16;
+        return x;
+    }
+
+    // Вершины, достижимые из pivot по дугам graph внутри подзадачи colour: их reached
+    // получает метку stamp. Обход по уровням; при pool != nullptr каждый достаточно широкий уровень - параллельно
+    static void Reach(const CsrGraph<T>& graph, int pivot, int colour, const DynamicArray<std::atomic<int>>& colours, DynamicArray<std::atomic<int>>& reached, int stamp, DynamicArray<DynamicArray<int>>& buffers, ThreadPool* pool) 
+    {
+        DynamicArray<int> frontier;
+        DynamicArray<int> next;
+        reached[pivot].store(stamp, std::memory_order_relaxed);
+        frontier.PushBack(pivot);
+
+        auto expand = [&](int u, DynamicArray<int>& out) 
+        {
+            for (int w : graph.GetNeighbors(u)) 
+            {
+                if (colours[w].load(std::memory_order_relaxed) != colour || reached[w].load(std::memory_order_relaxed) == stamp) continue;
+                if (reached[w].exchange(stamp, std::memory_order_relaxed) != stamp) 
+                {
+                    out.PushBack(w);
+                }
+            }
+        };
+
+        while (frontier.GetSize() > 0) 
+        {
+            next.Clear();
+            if (pool == nullptr || frontier.GetSize() < PARALLEL_FRONTIER) 
+            {
+                for (int k = 0; k < frontier.GetSize(); k++) 
+                {
+                    expand(frontier[k], next);
+                }
+            }
+            else 
+            {
+                pool->ParallelFor(0, frontier.GetSize(), [&](int k, int worker) 
+                {
+                    expand(frontier[k], buffers[worker]);
+                });
+                for (int worker = 0; worker < buffers.GetSize(); worker++) 
+                {
+                    for (int k = 0; k < buffers[worker].GetSize(); k++) 
+                    {
+                        next.PushBack(buffers[worker][k]);
+                    }
+                    buffers[worker].Clear();
+                }
+            }
+            std::swap(frontier, next);
+        }
+    }
+
+    // Отсечение (trim): вершина без входящих или без исходящих дуг среди неразмеченных -
+    // отдельная компонента. Очередь снимает такие вершины, пока они появляются, за O(V + E).
+    // labels получает временные номера, возвращается следующий свободный номер
+    static int Trim(const CsrGraph<T>& graph, const CsrGraph<T>& transposed, DynamicArray<int>& labels) 
+    {
+        int n = graph.GetVertexCount();
+        DynamicArray<int> inDegree(n);
+        DynamicArray<int> outDegree(n);
+        DynamicArray<int> queue(n);
+        DynamicArray<bool> queued(n);
+        int tail = 0;
+        for (int v = 0; v < n; v++) 
+        {
+            inDegree[v] = transposed.GetDegree(v);
+            outDegree[v] = graph.GetDegree(v);
+            if (inDegree[v] == 0 || outDegree[v] == 0) 
+            {
+                queued[v] = true;
+                queue[tail++] = v;
+            }
+        }
+
+        int count = 0;
+        for (int head = 0; head < tail; head++) 
+        {
+            int v = queue[head];
+            labels[v] = count++;
+            for (int w : graph.GetNeighbors(v)) 
+            {
+                if (--inDegree[w] == 0 && !queued[w]) 
+                {
+                    queued[w] = true;
+                    queue[tail++] = w;
+                }
+            }
+            for (int w : transposed.GetNeighbors(v)) 
+            {
+                if (--outDegree[w] == 0 && !queued[w]) 
+                {
+                    queued[w] = true;
+                    queue[tail++] = w;
+                }
+            }
+        }
+        return count;
+    }
+
+    // Итеративный алгоритм Тарьяна: стек вызовов заменён массивами вершин и позиций следующей дуги.
+    // Обходы запускаются из вершин vertexAt(0..count) и проходят только по вершинам, для которых
+    // inside(v) истинно; всего таких вершин не больше count. index[v] == -1 у непосещённых,
+    // labels[v] == -1 у ещё не закрытых. Закрытая компонента получает номер nextLabel():
+    // номера выдаются в порядке закрытия, то есть после номеров всех достижимых из неё компонент
+    template<typename VertexAt, typename Inside, typename NextLabel>
+    static void Tarjan(const CsrGraph<T>& graph, int count, VertexAt vertexAt, Inside inside, NextLabel nextLabel, DynamicArray<int>& labels, DynamicArray<int>& index, DynamicArray<int>& low) 
+    {
+        DynamicArray<int> stackVertex(count);
+        DynamicArray<int> stackArc(count);
+        DynamicArray<int> open(count);   // стек Тарьяна: вершины ещё не закрытых компонент
+        int counter = 0;
+        int openTop = 0;
+        for (int k = 0; k < count; k++) 
+        {
+            int start = vertexAt(k);
+            if (index[start] != -1) continue;
+            int depth = 0;
+            stackVertex[0] = start;
+            stackArc[0] = 0;
+            index[start] = low[start] = counter++;
+            open[openTop++] = start;
+            while (depth >= 0) 
+            {
+                int u = stackVertex[depth];
+                auto neighbors = graph.GetNeighbors(u);
+                if (stackArc[depth] < neighbors.GetCount()) 
+                {
+                    int v = neighbors.Target(stackArc[depth]++);
+                    if (!inside(v)) continue;
+                    if (index[v] == -1) 
+                    {
+                        index[v] = low[v] = counter++;
+                        open[openTop++] = v;
+                        depth++;
+                        stackVertex[depth] = v;
+                        stackArc[depth] = 0;
+                    }
+                    else if (labels[v] == -1) 
+                    {
+                        // v ещё на стеке Тарьяна - она в той же компоненте, что и u, или выше по пути
+                        low[u] = std::min(low[u], index[v]);
+                    }
+                    continue;
+                }
+
+                if (low[u] == index[u]) 
+                {
+                    int label = nextLabel();
+                    int w;
+                    do 
+                    {
+                        w = open[--openTop];
+                        labels[w] = label;
+                    } while (w != u);
+                }
+                depth--;
+                if (depth >= 0) 
+                {
+                    int parent = stackVertex[depth];
+                    low[parent] = std::min(low[parent], low[u]);
+                }
+            }
+        }
+    }
+
+    // Перенумерация компонент по наименьшей вершине: результат не зависит от исходной нумерации
+    static void NumberBySmallestVertex(DynamicArray<int>& labels, int count) 
+    {
+        DynamicArray<int> renumber(count);
+        for (int c = 0; c < count; c++) 
+        {
+            renumber[c] = -1;
+        }
+        int assigned = 0;
+        for (int v = 0; v < labels.GetSize(); v++) 
+        {
+            if (renumber[labels[v]] == -1) 
+            {
+                renumber[labels[v]] = assigned++;
+            }
+            labels[v] = renumber[labels[v]];
+        }
+    }
+
+    // Общая часть Condense: группирует вершины по компонентам, собирает дуги между компонентами
+    // (по одной на пару, с наименьшим весом) и перенумеровывает компоненты в порядке алгоритма Кана.
+    // Перед этим номера приводятся к каноническим, поэтому обе разметки дают одну и ту же конденсацию
+    static CondensationGraph<T> Build(const CsrGraph<T>& graph, DynamicArray<int>& labels, int count) 
+    {
+        int n = graph.GetVertexCount();
+        NumberBySmallestVertex(labels, count);
+        CondensationGraph<T> result;
+
+        // Вершины по компонентам подсчётом; внутри компоненты - по возрастанию индекса
+        DynamicArray<int> start(count + 1);
+        for (int v = 0; v < n; v++) 
+        {
+            start[labels[v] + 1]++;
+        }
+        for (int c = 0; c < count; c++) 
+        {
+            start[c + 1] += start[c];
+        }
+        DynamicArray<int> byComponent(n);
+        DynamicArray<int> position(count);
+        for (int c = 0; c < count; c++) 
+        {
+            position[c] = start[c];
+        }
+        for (int v = 0; v < n; v++) 
+        {
+            byComponent[position[labels[v]]++] = v;
+        }
+
+        // Дуги между компонентами без повторов: lastSource[d] == c, если дуга c -> d уже встречалась
+        DynamicArray<int> arcStart(count + 1);
+        DynamicArray<int> arcTarget;
+        DynamicArray<double> arcWeight;
+        DynamicArray<int> lastSource(count);
+        DynamicArray<int> slot(count);
+        DynamicArray<int> inDegree(count);
+        for (int c = 0; c < count; c++) 
+        {
+            lastSource[c] = -1;
+        }
+        for (int c = 0; c < count; c++) 
+        {
+            arcStart[c] = arcTarget.GetSize();
+            for (int i = start[c]; i < start[c + 1]; i++) 
+            {
+                auto neighbors = graph.GetNeighbors(byComponent[i]);
+                for (int j = 0; j < neighbors.GetCount(); j++) 
+                {
+                    int d = labels[neighbors.Target(j)];
+                    if (d == c) continue;
+                    if (lastSource[d] != c) 
+                    {
+                        lastSource[d] = c;
+                        slot[d] = arcTarget.GetSize();
+                        arcTarget.PushBack(d);
+                        arcWeight.PushBack(neighbors.Weight(j));
+                        inDegree[d]++;
+                    }
+                    else 
+                    {
+                        arcWeight[slot[d]] = std::min(arcWeight[slot[d]], neighbors.Weight(j));
+                    }
+                }
+            }
+        }
+        arcStart[count] = arcTarget.GetSize();
+
+        // Граф компонент ацикличен, поэтому алгоритм Кана упорядочивает все компоненты
+        DynamicArray<int> order(count);
+        int tail = 0;
+        for (int c = 0; c < count; c++) 
+        {
+            if (inDegree[c] == 0) order[tail++] = c;
+        }
+        for (int head = 0; head < tail; head++) 
+        {
+            int c = order[head];
+            for (int i = arcStart[c]; i < arcStart[c + 1]; i++) 
+            {
+                if (--inDegree[arcTarget[i]] == 0) order[tail++] = arcTarget[i];
+            }
+        }
+        DynamicArray<int> rank(count);
+        for (int k = 0; k < count; k++) 
+        {
+            rank[order[k]] = k;
+        }
+
+        result.members = DynamicArray<T>(n);
+        result.offsets = DynamicArray<int>(count + 1);
+        result.componentOf.Reserve(n);
+        int filled = 0;
+        for (int k = 0; k < count; k++) 
+        {
+            int c = order[k];
+            result.offsets[k] = filled;
+            result.dag.AddVertex(k);
+            for (int i = start[c]; i < start[c + 1]; i++) 
+            {
+                const T& vertex = graph.GetVertex(byComponent[i]);
+                result.members[filled++] = vertex;
+                result.componentOf.Add(vertex, k);
+            }
+        }
+        result.offsets[count] = filled;
+        for (int k = 0; k < count; k++) 
+        {
+            int c = order[k];
+            for (int i = arcStart[c]; i < arcStart[c + 1]; i++) 
+            {
+                result.dag.AddEdge(k, rank[arcTarget[i]], arcWeight[i]);
+            }
+        }
+        return result;
+    }
+
+public:
+    // Итеративный алгоритм Тарьяна на CSR-снимке.
+    // labels[v] получает номер компоненты вершины v; компонента закрывается после всех достижимых
+    // из неё, и номера выдаются с конца, поэтому они топологически упорядочены: дуги между
+    // компонентами ведут от меньшего номера к большему. Возвращает число компонент
+    static int LabelComponents(const CsrGraph<T>& graph, DynamicArray<int>& labels) 
+    {
+        int n = graph.GetVertexCount();
+        labels = DynamicArray<int>(n);
+        DynamicArray<int> index(n);
+        DynamicArray<int> low(n);
+        for (int v = 0; v < n; v++) 
+        {
+            index[v] = -1;
+            labels[v] = -1;
+        }
+
+        int closed = 0;
+        Tarjan(graph, n, [](int k) { return k; }, [](int) { return true; }, [&closed]() { return closed++; }, labels, index, low);
+
+        for (int v = 0; v < n; v++) 
+        {
+            labels[v] = closed - 1 - labels[v];
+        }
+        return closed;
+    }
+
+    // Параллельный forward-backward (Флейшер, Хендриксон, Пинар) с отсечением тривиальных компонент.
+    // Из опорной вершины подзадачи ищутся достижимые вперёд (F) и назад (B) вершины:
+    // F ∩ B - её компонента, а F \ B, B \ F и остаток - независимые подзадачи. Крупные подзадачи
+    // разбиваются по одной с параллельными обходами, остальные раздаются пулу целиком, а мелкие
+    // и слишком глубокие размечаются Тарьяном. Разбиение совпадает с LabelComponents, но компоненты
+    // нумеруются по наименьшей вершине, а не топологически. Возвращает число компонент
+    static int LabelComponentsParallel(const CsrGraph<T>& graph, DynamicArray<int>& labels, ThreadPool& pool) 
+    {
+        int n = graph.GetVertexCount();
+        labels = DynamicArray<int>(n);
+        for (int v = 0; v < n; v++) 
+        {
+            labels[v] = -1;
+        }
+        CsrGraph<T> transposed = graph.Transpose();
+        std::atomic<int> count(Trim(graph, transposed, labels));
+
+        // Подзадачи - отрезки массива items; colours[v] - подзадача вершины v или -1, если она размечена.
+        // Подзадачи не пересекаются, и каждая пишет только в свои вершины и свой отрезок; colours
+        // атомарны, потому что обходы читают их и у соседей из чужих подзадач
+        DynamicArray<std::atomic<int>> colours(n);
+        DynamicArray<std::atomic<int>> forward(n);
+        DynamicArray<std::atomic<int>> backward(n);
+        DynamicArray<int> index(n);   // рабочая память Тарьяна для мелких подзадач
+        DynamicArray<int> low(n);
+        DynamicArray<int> items;
+        items.Reserve(n);
+        for (int v = 0; v < n; v++) 
+        {
+            colours[v].store(labels[v] == -1 ? 0 : -1, std::memory_order_relaxed);
+            forward[v].store(-1, std::memory_order_relaxed);
+            backward[v].store(-1, std::memory_order_relaxed);
+            index[v] = -1;
+            if (labels[v] == -1) 
+            {
+                items.PushBack(v);
+            }
+        }
+        DynamicArray<int> partitioned(items.GetSize());
+        DynamicArray<DynamicArray<int>> buffers(pool.GetThreadCount());
+        DynamicArray<DynamicArray<Segment>> produced(pool.GetThreadCount());
+        std::atomic<int> nextColour(1);
+
+        // Размечает подзадачу или разбивает её, складывая новые подзадачи в produced[worker].
+        // При reachPool != nullptr широкие уровни обходов F и B раскладываются по пулу
+        auto process = [&](const Segment& segment, int worker, ThreadPool* reachPool) 
+        {
+            int begin = segment.begin;
+            int end = segment.end;
+            int colour = colours[items[begin]].load(std::memory_order_relaxed);
+            if (end - begin <= SEQUENTIAL_SEGMENT || segment.depth >= MAX_SPLIT_DEPTH) 
+            {
+                Tarjan(graph, end - begin, 
+                    [&](int k) { return items[begin + k]; }, 
+                    [&](int v) { return colours[v].load(std::memory_order_relaxed) == colour; }, 
+                    [&]() { return count.fetch_add(1, std::memory_order_relaxed); }, 
+                    labels, index, low);
+                return;
+            }
+
+            // Опорная вершина псевдослучайна: при выборе первой или самой связной вершины цепочка
+            // циклов на каждом шаге отделяет одну маленькую компоненту, и разбиение становится квадратичным
+            int pivot = items[begin + static_cast<int>(Scramble(static_cast<unsigned int>(colour) + 1u) % static_cast<unsigned int>(end - begin))];
+            Reach(graph, pivot, colour, colours, forward, colour, buffers, reachPool);
+            Reach(transposed, pivot, colour, colours, backward, colour, buffers, reachPool);
+
+            // Устойчивое разбиение отрезка на F \ B, B \ F и остаток; F ∩ B получает номер компоненты
+            int groupStart[3] = {begin, begin, begin};
+            int groupSize[3] = {0, 0, 0};
+            for (int i = begin; i < end; i++) 
+            {
+                int v = items[i];
+                bool inForward = forward[v].load(std::memory_order_relaxed) == colour;
+                bool inBackward = backward[v].load(std::memory_order_relaxed) == colour;
+                if (inForward && inBackward) continue;
+                groupSize[inForward ? 0 : (inBackward ? 1 : 2)]++;
+            }
+            groupStart[1] = groupStart[0] + groupSize[0];
+            groupStart[2] = groupStart[1] + groupSize[1];
+            int groupColour[3];
+            for (int g = 0; g < 3; g++) 
+            {
+                groupColour[g] = groupSize[g] > 0 ? nextColour.fetch_add(1, std::memory_order_relaxed) : -1;
+            }
+
+            int component = count.fetch_add(1, std::memory_order_relaxed);
+            int fill[3] = {groupStart[0], groupStart[1], groupStart[2]};
+            for (int i = begin; i < end; i++) 
+            {
+                int v = items[i];
+                bool inForward = forward[v].load(std::memory_order_relaxed) == colour;
+                bool inBackward = backward[v].load(std::memory_order_relaxed) == colour;
+                if (inForward && inBackward) 
+                {
+                    labels[v] = component;
+                    colours[v].store(-1, std::memory_order_relaxed);
+                    continue;
+                }
+                int g = inForward ? 0 : (inBackward ? 1 : 2);
+                colours[v].store(groupColour[g], std::memory_order_relaxed);
+                partitioned[fill[g]++] = v;
+            }
+            for (int i = begin; i < fill[2]; i++) 
+            {
+                items[i] = partitioned[i];
+            }
+            for (int g = 0; g < 3; g++) 
+            {
+                if (groupSize[g] > 0) 
+                {
+                    produced[worker].PushBack(Segment{groupStart[g], groupStart[g] + groupSize[g], segment.depth + 1});
+                }
+            }
+        };
+
+        // Подзадачи обрабатываются волнами: крупные - по одной с параллельными обходами внутри,
+        // остальные волны - как независимые задачи пула
+        DynamicArray<Segment> pending;
+        if (items.GetSize() > 0) 
+        {
+            pending.PushBack(Segment{0, items.GetSize(), 0});
+        }
+        DynamicArray<Segment> batch;
+        while (pending.GetSize() > 0) 
+        {
+            batch.Clear();
+            for (int k = 0; k < pending.GetSize(); k++) 
+            {
+                if (pending[k].end - pending[k].begin >= PARALLEL_SEGMENT) 
+                {
+                    process(pending[k], 0, &pool);
+                }
+                else 
+                {
+                    batch.PushBack(pending[k]);
+                }
+            }
+            pool.ParallelFor(0, batch.GetSize(), [&](int k, int worker) 
+            {
+                process(batch[k], worker, nullptr);
+            }, 1);
+
+            pending.Clear();
+            for (int worker = 0; worker < produced.GetSize(); worker++) 
+            {
+                for (int k = 0; k < produced[worker].GetSize(); k++) 
+                {
+                    pending.PushBack(produced[worker][k]);
+                }
+                produced[worker].Clear();
+            }
+        }
+
+        // Номера по наименьшей вершине компоненты не зависят от порядка обработки подзадач
+        int total = count.load();
+        NumberBySmallestVertex(labels, total);
+        return total;
+    }
+
+    static int LabelComponentsParallel(const CsrGraph<T>& graph, DynamicArray<int>& labels) 
+    {
+        return LabelComponentsParallel(graph, labels, ThreadPool::Shared());
+    }
+
+    // Конденсация по разметке алгоритма Тарьяна
+    static CondensationGraph<T> Condense(const CsrGraph<T>& graph) 
+    {
+        DynamicArray<int> labels;
+        int count = LabelComponents(graph, labels);
+        return Build(graph, labels, count);
+    }
+
+    // Конденсация по параллельной разметке; нумерация компонент та же, что у Condense(graph)
+    static CondensationGraph<T> Condense(const CsrGraph<T>& graph, ThreadPool& pool) 
+    {
+        DynamicArray<int> labels;
+        int count = LabelComponentsParallel(graph, labels, pool);
+        return Build(graph, labels, count);
+    }
+
+    static CondensationGraph<T> Condense(const DirectedGraph<T>& graph) 
+    {
+        return Condense(CsrGraph<T>(graph));
+    }
+
+    // Компоненты в топологическом порядке конденсации, вершины внутри - в порядке индексов
+    static Sequence<Sequence<T>*>* FindComponents(const CsrGraph<T>& graph) 
+    {
+        CondensationGraph<T> condensation = Condense(graph);
+        auto* components = new MutableArraySequence<Sequence<T>*>();
+        for (int c = 0; c < condensation.GetComponentCount(); c++) 
+        {
+            components->Append(condensation.GetMembers(c));
+        }
+        return components;
+    }
+
+    static Sequence<Sequence<T>*>* FindComponents(const DirectedGraph<T>& graph) 
+    {
+        return FindComponents(CsrGraph<T>(graph));
+    }
+
+    static int CountComponents(const DirectedGraph<T>& graph) 
+    {
+        DynamicArray<int> labels;
+        return LabelComponents(CsrGraph<T>(graph), labels);
+    }
+
+    static bool IsStronglyConnected(const DirectedGraph<T>& graph) 
+    {
+        return CountComponents(graph) <= 1;
+    }
+
+    static bool AreStronglyConnected(const DirectedGraph<T>& graph, T vertex1, T vertex2) 
+    {
+        CsrGraph<T> csr(graph);
+        int first = csr.IndexOf(vertex1);
+        int second = csr.IndexOf(vertex2);
+        if (first == -1 || second == -1) 
+        {
+            return false;
+        }
+        DynamicArray<int> labels;
+        LabelComponents(csr, labels);
+        return labels[first] == labels[second];
+    }
+};
+
+#endif // STRONGLY_CONNECTED_COMPONENTS_H
@@ -3,212 +3,394 @@
 
 #include "../graph/DirectedGraph.h"
 #include "../graph/GraphBase.h" 
+#include "../graph/CsrGraph.h"
 #include "../structures/Set.h"
 #include "../structures/Sequence.h"
+#include "../structures/thread_pool.h"
+#include <algorithm>
+#include <atomic>
 #include <stdexcept>
 
 template<typename T>
 class TopologicalSort 
 {
+private:
+    // Волна короче этого порога обрабатывается в вызывающем потоке без обращения к пулу
+    static const int PARALLEL_WAVE = 1024;
+
 public:
-    // Метод для топологической сортировки
-    static Sequence<T>* KahnSort(const DirectedGraph<T>& graph) 
+    // Алгоритм Кана на CSR-снимке: order получает индексы вершин в топологическом порядке.
+    // Возвращает число упорядоченных вершин; оно меньше числа вершин, если в графе есть цикл
+    static int KahnOrder(const CsrGraph<T>& graph, DynamicArray<int>& order) 
     {
-        if (graph.GetVertexCount() == 0) 
+        int n = graph.GetVertexCount();
+        DynamicArray<int> inDegree(n);
+        for (int u = 0; u < n; u++) 
         {
-            return new MutableArraySequence<T>();
+            for (int v : graph.GetNeighbors(u)) 
+            {
+                inDegree[v]++;
+            }
         }
         
-        Dictionary<T, int> inDegree;
-        auto vertices = graph.GetAllVertices();
-        
-        for (int i = 0; i < vertices->GetLength(); i++) 
+        // order одновременно служит очередью: вершины в него только добавляются
+        order = DynamicArray<int>(n);
+        int head = 0;
+        int tail = 0;
+        for (int u = 0; u < n; u++) 
         {
-            T vertex = vertices->Get(i);
-            inDegree.Add(vertex, 0);
+            if (inDegree[u] == 0) 
+            {
+                order[tail++] = u;
+            }
         }
         
-        for (int i = 0; i < vertices->GetLength(); i++) 
+        while (head < tail) 
         {
-            T from = vertices->Get(i);
-            auto adj = graph.GetAdjacentVertices(from);
-            
-            for (int j = 0; j < adj->GetLength(); j++) 
+            int current = order[head++];
+            for (int neighbor : graph.GetNeighbors(current)) 
             {
-                T to = adj->Get(j);
-                int currentDegree = inDegree.Get(to);
-                inDegree.Add(to, currentDegree + 1);
+                if (--inDegree[neighbor] == 0) 
+                {
+                    order[tail++] = neighbor;
+                }
             }
-            
-            delete adj;
         }
         
-        delete vertices;
-        
-        Queue<T> queue;
-        inDegree.ForEachKey([&queue, &inDegree](const T& vertex) 
+        order.Resize(tail);
+        return tail;
+    }
+    
+    // Метод для топологической сортировки
+    static Sequence<T>* KahnSort(const CsrGraph<T>& graph) 
+    {
+        DynamicArray<int> order;
+        if (KahnOrder(graph, order) != graph.GetVertexCount()) 
         {
-            if (inDegree.Get(vertex) == 0) 
-            {
-                queue.Enqueue(vertex);
-            }
-        });
+            throw std::runtime_error("Graph contains a cycle - topological sort not possible");
+        }
         
-        // 3. Алгоритм Кана
         auto* result = new MutableArraySequence<T>();
-        int visitedCount = 0;
-        
-        while (!queue.IsEmpty()) 
-        {
-            T current = queue.Dequeue();
-            result->Append(current);
-            visitedCount++;
-            
-            auto adj = graph.GetAdjacentVertices(current);
-            for (int i = 0; i < adj->GetLength(); i++) 
-            {
-                T neighbor = adj->Get(i);
-                int newDegree = inDegree.Get(neighbor) - 1;
-                inDegree.Add(neighbor, newDegree);
-                
-                if (newDegree == 0) 
+        result->Reserve(order.GetSize());
+        for (int i = 0; i < order.GetSize(); i++) 
+        {
+            result->Append(graph.GetVertex(order[i]));
+        }
+        return result;
+    }
+    
+    static Sequence<T>* KahnSort(const DirectedGraph<T>& graph) 
+    {
+        if (graph.GetVertexCount() == 0) 
+        {
+            return new MutableArraySequence<T>();
+        }
+        return KahnSort(CsrGraph<T>(graph));
+    }
+    
+    // Топологический порядок обратным порядком выхода из DFS на CSR-снимке, без рекурсии:
+    // стек хранит вершину и позицию следующей дуги в её строке и выделяется один раз на n вершин,
+    // поэтому глубина обхода не ограничена стеком вызовов. Вершины и дуги перебираются
+    // по возрастанию индексов - в том же порядке, что у рекурсивного обхода по графу.
+    // Возвращает false, если найден цикл (дуга в вершину, которая ещё на стеке)
+    static bool DFSOrder(const CsrGraph<T>& graph, DynamicArray<int>& order) 
+    {
+        const char WHITE = 0;
+        const char GRAY = 1;
+        const char BLACK = 2;
+        int n = graph.GetVertexCount();
+        DynamicArray<char> color(n);
+        DynamicArray<int> stackVertex(n);
+        DynamicArray<int> stackArc(n);
+        order = DynamicArray<int>(n);
+        int position = n;   // order заполняется с конца: выход из вершины - очередная позиция слева
+
+        for (int start = 0; start < n; start++) 
+        {
+            if (color[start] != WHITE) continue;
+            int depth = 0;
+            stackVertex[0] = start;
+            stackArc[0] = 0;
+            color[start] = GRAY;
+            while (depth >= 0) 
+            {
+                int u = stackVertex[depth];
+                auto neighbors = graph.GetNeighbors(u);
+                if (stackArc[depth] < neighbors.GetCount()) 
                 {
-                    queue.Enqueue(neighbor);
+                    int v = neighbors.Target(stackArc[depth]++);
+                    if (color[v] == GRAY) return false;
+                    if (color[v] == BLACK) continue;
+                    color[v] = GRAY;
+                    depth++;
+                    stackVertex[depth] = v;
+                    stackArc[depth] = 0;
+                    continue;
                 }
+                color[u] = BLACK;
+                order[--position] = u;
+                depth--;
             }
-            
-            delete adj;
         }
-        
-        if (visitedCount != graph.GetVertexCount()) 
+        return true;
+    }
+
+    static Sequence<T>* DFSSort(const CsrGraph<T>& graph) 
+    {
+        DynamicArray<int> order;
+        if (!DFSOrder(graph, order)) 
         {
-            delete result;
             throw std::runtime_error("Graph contains a cycle - topological sort not possible");
         }
         
+        auto* result = new MutableArraySequence<T>();
+        result->Reserve(order.GetSize());
+        for (int i = 0; i < order.GetSize(); i++) 
+        {
+            result->Append(graph.GetVertex(order[i]));
+        }
         return result;
     }
-    
+
     // Метод для топологической сортировки
     static Sequence<T>* DFSSort(const DirectedGraph<T>& graph) 
     {
         if (graph.GetVertexCount() == 0) {
             return new MutableArraySequence<T>();
         }
-        
-        Set<T> visited;
-        Set<T> tempMark;
-        Stack<T> resultStack;
-        auto vertices = graph.GetAllVertices();
-        
-        std::function<void(T)> dfs = [&](T vertex) 
+        return DFSSort(CsrGraph<T>(graph));
+    }
+    
+    // Алгоритм Кана по волнам: волна - все вершины, у которых к её началу не осталось входящих дуг.
+    // Вершины волны обрабатываются параллельно, полустепени захода уменьшаются атомарно, и вершину
+    // забирает в следующую волну поток, обнуливший её счётчик. order получает топологический порядок
+    // (волна за волной, внутри волны - по возрастанию индексов, поэтому результат не зависит от числа
+    // потоков), levels[v] - номер волны вершины v, то есть длина самого длинного пути, ведущего в v;
+    // у вершин, не упорядоченных из-за цикла, -1. Возвращает число упорядоченных вершин
+    static int KahnLevels(const CsrGraph<T>& graph, DynamicArray<int>& order, DynamicArray<int>& levels, ThreadPool& pool) 
+    {
+        int n = graph.GetVertexCount();
+        DynamicArray<std::atomic<int>> inDegree(n);
+        pool.ParallelFor(0, n, [&](int v, int) 
+        {
+            inDegree[v].store(0, std::memory_order_relaxed);
+        });
+        pool.ParallelFor(0, n, [&](int u, int) 
         {
-            if (tempMark.Contains(vertex))
+            for (int v : graph.GetNeighbors(u)) 
             {
-                throw std::runtime_error("Graph contains a cycle - topological sort not possible");
+                inDegree[v].fetch_add(1, std::memory_order_relaxed);
             }
-            
-            if (visited.Contains(vertex)) return;
-            
-            tempMark.Add(vertex);
-            
-            auto adj = graph.GetAdjacentVertices(vertex);
-            for (int i = 0; i < adj->GetLength(); i++) 
+        });
+
+        order = DynamicArray<int>(n);
+        levels = DynamicArray<int>(n);
+        int tail = 0;
+        for (int v = 0; v < n; v++) 
+        {
+            levels[v] = -1;
+            if (inDegree[v].load(std::memory_order_relaxed) == 0) 
             {
-                dfs(adj->Get(i));
+                order[tail++] = v;
+                levels[v] = 0;
             }
-            delete adj;
-            
-            tempMark.Remove(vertex);
-            visited.Add(vertex);
-            resultStack.Push(vertex);
-        };
-        
-        for (int i = 0; i < vertices->GetLength(); i++) 
+        }
+
+        // Дуги волны [begin, end) снимаются целиком, новые вершины дописываются за end
+        DynamicArray<DynamicArray<int>> buffers(pool.GetThreadCount());
+        int begin = 0;
+        for (int level = 1; begin < tail; level++) 
         {
-            T vertex = vertices->Get(i);
-            if (!visited.Contains(vertex)) 
+            int end = tail;
+            if (end - begin < PARALLEL_WAVE) 
+            {
+                for (int i = begin; i < end; i++) 
+                {
+                    for (int v : graph.GetNeighbors(order[i])) 
+                    {
+                        if (inDegree[v].fetch_sub(1, std::memory_order_relaxed) == 1) 
+                        {
+                            order[tail++] = v;
+                        }
+                    }
+                }
+            }
+            else 
+            {
+                pool.ParallelFor(begin, end, [&](int i, int worker) 
+                {
+                    for (int v : graph.GetNeighbors(order[i])) 
+                    {
+                        if (inDegree[v].fetch_sub(1, std::memory_order_relaxed) == 1) 
+                        {
+                            buffers[worker].PushBack(v);
+                        }
+                    }
+                });
+                for (int worker = 0; worker < buffers.GetSize(); worker++) 
+                {
+                    for (int k = 0; k < buffers[worker].GetSize(); k++) 
+                    {
+                        order[tail++] = buffers[worker][k];
+                    }
+                    buffers[worker].Clear();
+                }
+            }
+            std::sort(order.Data() + end, order.Data() + tail);
+            for (int i = end; i < tail; i++) 
             {
-                dfs(vertex);
+                levels[order[i]] = level;
             }
+            begin = end;
         }
-        
-        delete vertices;
-        
-        auto* result = new MutableArraySequence<T>();
-        while (!resultStack.IsEmpty()) 
+
+        order.Resize(tail);
+        return tail;
+    }
+
+    static int KahnLevels(const CsrGraph<T>& graph, DynamicArray<int>& order, DynamicArray<int>& levels) 
+    {
+        return KahnLevels(graph, order, levels, ThreadPool::Shared());
+    }
+
+    // Топологическая сортировка по волнам: levels->Get(l) - вершины уровня l, подряд уровни дают
+    // топологический порядок
+    static Sequence<Sequence<T>*>* LevelSort(const CsrGraph<T>& graph) 
+    {
+        DynamicArray<int> order;
+        DynamicArray<int> levels;
+        if (KahnLevels(graph, order, levels) != graph.GetVertexCount()) 
         {
-            result->Append(resultStack.Pop());
+            throw std::runtime_error("Graph contains a cycle - topological sort not possible");
+        }
+
+        auto* result = new MutableArraySequence<Sequence<T>*>();
+        MutableArraySequence<T>* wave = nullptr;
+        for (int i = 0; i < order.GetSize(); i++) 
+        {
+            if (levels[order[i]] == result->GetLength()) 
+            {
+                wave = new MutableArraySequence<T>();
+                result->Append(wave);
+            }
+            wave->Append(graph.GetVertex(order[i]));
         }
-        
         return result;
     }
+
+    static Sequence<Sequence<T>*>* LevelSort(const DirectedGraph<T>& graph) 
+    {
+        return LevelSort(CsrGraph<T>(graph));
+    }
+
+    // Проверка, является ли граф ациклическим. Порядок не строится: алгоритм Кана со стеком
+    // источников только считает снятые вершины. Граф без дуг принимается без обхода,
+    // граф без источников отвергается сразу после подсчёта полустепеней
+    static bool IsAcyclic(const CsrGraph<T>& graph) 
+    {
+        int n = graph.GetVertexCount();
+        if (graph.GetArcCount() == 0) return true;
+
+        DynamicArray<int> inDegree(n);
+        for (int u = 0; u < n; u++) 
+        {
+            for (int v : graph.GetNeighbors(u)) 
+            {
+                inDegree[v]++;
+            }
+        }
+        DynamicArray<int> stack(n);
+        int top = 0;
+        for (int u = 0; u < n; u++) 
+        {
+            if (inDegree[u] == 0) stack[top++] = u;
+        }
+        if (top == 0) return false;
+
+        int removed = 0;
+        while (top > 0) 
+        {
+            int u = stack[--top];
+            removed++;
+            for (int v : graph.GetNeighbors(u)) 
+            {
+                if (--inDegree[v] == 0) stack[top++] = v;
+            }
+        }
+        return removed == n;
+    }
     
-    // Проверка, является ли граф ациклическим
     static bool IsAcyclic(const DirectedGraph<T>& graph) 
     {
-        try 
+        return IsAcyclic(CsrGraph<T>(graph));
+    }
+    
+    // Нахождение всех источников (вершин без входящих рёбер от других вершин)
+    static Sequence<T>* FindSources(const CsrGraph<T>& graph) 
+    {
+        int n = graph.GetVertexCount();
+        DynamicArray<bool> hasIncoming(n);
+        for (int u = 0; u < n; u++) 
         {
-            auto result = KahnSort(graph);
-            delete result;
-            return true;
-        } 
-        catch (const std::runtime_error&) 
+            for (int v : graph.GetNeighbors(u)) 
+            {
+                if (v != u) 
+                {
+                    hasIncoming[v] = true;
+                }
+            }
+        }
+        
+        auto* result = new MutableArraySequence<T>();
+        for (int u = 0; u < n; u++) 
         {
-            return false;
+            if (!hasIncoming[u]) 
+            {
+                result->Append(graph.GetVertex(u));
+            }
         }
+        return result;
     }
     
-    // Нахождение всех источников
+    // Для графа со списком входящих рёбер хватает счётчиков степеней, O(V log V)
     static Sequence<T>* FindSources(const DirectedGraph<T>& graph) 
     {
         auto* result = new MutableArraySequence<T>();
-        auto vertices = graph.GetAllVertices();
-        
-        for (int i = 0; i < vertices->GetLength(); i++) 
+        graph.ForEachVertex([&](const T& v) 
         {
-            T vertex = vertices->Get(i);
-            bool isSource = true;
-            for (int j = 0; j < vertices->GetLength(); j++) 
+            int selfLoop = graph.HasEdge(v, v) ? 1 : 0;
+            if (graph.InDegree(v) == selfLoop) 
             {
-                T other = vertices->Get(j);
-                if (other != vertex && graph.HasEdge(other, vertex)) 
-                {
-                    isSource = false;
-                    break;
-                }
+                result->Append(v);
             }
-            
-            if (isSource) 
+        });
+        return result;
+    }
+    
+    // Нахождение всех стоков
+    static Sequence<T>* FindSinks(const CsrGraph<T>& graph) 
+    {
+        auto* result = new MutableArraySequence<T>();
+        for (int u = 0; u < graph.GetVertexCount(); u++) 
+        {
+            if (graph.GetDegree(u) == 0) 
             {
-                result->Append(vertex);
+                result->Append(graph.GetVertex(u));
             }
         }
-        
-        delete vertices;
         return result;
     }
     
-    // Нахождение всех стоков
     static Sequence<T>* FindSinks(const DirectedGraph<T>& graph) 
     {
         auto* result = new MutableArraySequence<T>();
-        auto vertices = graph.GetAllVertices();
-        
-        for (int i = 0; i < vertices->GetLength(); i++) 
+        graph.ForEachVertex([&](const T& v) 
         {
-            T vertex = vertices->Get(i);
-            auto adj = graph.GetAdjacentVertices(vertex);
-            bool isSink = (adj->GetLength() == 0);
-            delete adj;
-            
-            if (isSink) 
+            if (graph.OutDegree(v) == 0) 
             {
-                result->Append(vertex);
+                result->Append(v);
             }
-        }
-        
-        delete vertices;
+        });
         return result;
     }
 };
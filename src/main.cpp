@@ -454,78 +454,24 @@ public:
     static double GetGraphDiameter(const std::vector<int>& vertices,
                                   const std::vector<Edge>& edges,
                                   bool isDirected = false) {
-        double maxDiameter = 0.0;
-        
-        for (int start : vertices) {
-            auto distances = GetAllDistances(vertices, edges, start, isDirected);
-            
-            for (const auto& [vertex, dist] : distances) {
-                if (dist < std::numeric_limits<double>::infinity() && dist > maxDiameter) {
-                    maxDiameter = dist;
-                }
-            }
-        }
-        
-        return maxDiameter;
+        return GetEccentricities(vertices, edges, isDirected).GetDiameter();
     }
     
     // Вычисление радиуса графа
     static double GetGraphRadius(const std::vector<int>& vertices,
                                 const std::vector<Edge>& edges,
                                 bool isDirected = false) {
-        double minRadius = std::numeric_limits<double>::infinity();
-        
-        for (int start : vertices) {
-            auto distances = GetAllDistances(vertices, edges, start, isDirected);
-            
-            double eccentricity = 0.0;
-            for (const auto& [vertex, dist] : distances) {
-                if (dist < std::numeric_limits<double>::infinity() && dist > eccentricity) {
-                    eccentricity = dist;
-                }
-            }
-            
-            if (eccentricity < minRadius) {
-                minRadius = eccentricity;
-            }
-        }
-        
-        return (minRadius == std::numeric_limits<double>::infinity()) ? 0.0 : minRadius;
+        return GetEccentricities(vertices, edges, isDirected).GetRadius();
     }
     
-    // Нахождение центра графа
+    // Нахождение центра графа: вершины с минимальным эксцентриситетом
     static std::vector<int> FindGraphCenter(const std::vector<int>& vertices,
                                            const std::vector<Edge>& edges,
                                            bool isDirected = false) {
-        std::vector<int> centerVertices;
-        double minEccentricity = std::numeric_limits<double>::infinity();
-        std::map<int, double> eccentricities;
-        
-        // Вычисляем эксцентриситет для каждой вершины
-        for (int vertex : vertices) {
-            auto distances = GetAllDistances(vertices, edges, vertex, isDirected);
-            
-            double eccentricity = 0.0;
-            for (const auto& [v, dist] : distances) {
-                if (dist < std::numeric_limits<double>::infinity() && dist > eccentricity) {
-                    eccentricity = dist;
-                }
-            }
-            
-            eccentricities[vertex] = eccentricity;
-            
-            if (eccentricity < minEccentricity) {
-                minEccentricity = eccentricity;
-            }
-        }
-        
-        // Находим все вершины с минимальным эксцентриситетом
-        for (const auto& [vertex, eccentricity] : eccentricities) {
-            if (eccentricity == minEccentricity) {
-                centerVertices.push_back(vertex);
-            }
-        }
-        
+        GraphEccentricities<int> eccentricities = GetEccentricities(vertices, edges, isDirected);
+        const DynamicArray<int>& center = eccentricities.GetCenter();
+        std::vector<int> centerVertices(center.Data(), center.Data() + center.GetSize());
+        std::sort(centerVertices.begin(), centerVertices.end());
         return centerVertices;
     }
     
@@ -733,52 +679,24 @@ public:
     }
     
 private:
-    // Получение всех расстояний от стартовой вершины
-    static std::map<int, double> GetAllDistances(const std::vector<int>& vertices,
-                                                const std::vector<Edge>& edges,
-                                                int start,
-                                                bool isDirected = false) {
-        std::map<int, std::vector<std::pair<int, double>>> adj;
-        for (const auto& vertex : vertices) {
-            adj[vertex] = std::vector<std::pair<int, double>>();
+    // Эксцентриситеты всех вершин за один параллельный проход Дейкстры с рабочей памятью
+    // на поток: O(V) памяти на поток вместо матрицы V x V. Из кратных рёбер берётся самое лёгкое
+    static GraphEccentricities<int> GetEccentricities(const std::vector<int>& vertices,
+                                                      const std::vector<Edge>& edges,
+                                                      bool isDirected = false) {
+        std::unique_ptr<GraphBase<int>> graph(CreateGraph<int>(isDirected));
+        for (int vertex : vertices) {
+            graph->AddVertex(vertex);
         }
         
         for (const auto& edge : edges) {
-            adj[edge.from].push_back({edge.to, edge.weight});
-            if (!isDirected) {
-                adj[edge.to].push_back({edge.from, edge.weight});
-            }
-        }
-        
-        std::map<int, double> dist;
-        std::priority_queue<std::pair<double, int>,
-                           std::vector<std::pair<double, int>>,
-                           std::greater<std::pair<double, int>>> pq;
-        
-        for (const auto& vertex : vertices) {
-            dist[vertex] = std::numeric_limits<double>::infinity();
-        }
-        dist[start] = 0.0;
-        pq.push({0.0, start});
-        
-        while (!pq.empty()) {
-            auto [currentDist, current] = pq.top();
-            pq.pop();
-            
-            if (currentDist > dist[current]) continue;
-            
-            if (adj.find(current) != adj.end()) {
-                for (const auto& [neighbor, weight] : adj[current]) {
-                    double newDist = currentDist + weight;
-                    if (newDist < dist[neighbor]) {
-                        dist[neighbor] = newDist;
-                        pq.push({newDist, neighbor});
-                    }
-                }
+            if (graph->HasEdge(edge.from, edge.to) && graph->GetEdgeWeight(edge.from, edge.to) <= edge.weight) {
+                continue;
             }
+            graph->AddEdge(edge.from, edge.to, edge.weight);
         }
         
-        return dist;
+        return ShortestPath<int>::ComputeEccentricities(CsrGraph<int>(*graph));
     }
     
     static bool HasCycleDFS(int vertex,
@@ -2289,6 +2207,19 @@ void MainWindow::OnFindShortestPath(wxCommandEvent& event) {
     }
 }
 
+// На графах больше этого размера перебор всех источников слишком долог:
+// диаметр и радиус оцениваются доказанными границами за ограниченное время
+static const int EXACT_ECCENTRICITY_LIMIT = 5000;
+static const double ECCENTRICITY_TIME_BUDGET = 2.0;
+
+static wxString FormatDistanceBounds(const wxString& name, const DistanceBounds& bounds) {
+    if (bounds.IsExact()) {
+        return wxString::Format(wxT("%s: %.2f"), name, bounds.GetLower());
+    }
+    return wxString::Format(wxT("%s: от %.2f до %.2f (оценка за %d поисков)"),
+                            name, bounds.GetLower(), bounds.GetUpper(), bounds.GetSearchCount());
+}
+
 void MainWindow::OnGetDiameter(wxCommandEvent& event) {
     if (vertices.empty()) {
         wxMessageBox(wxT("Граф пуст!"), wxT("Ошибка"), wxOK | wxICON_WARNING);
@@ -2296,6 +2227,18 @@ void MainWindow::OnGetDiameter(wxCommandEvent& event) {
     }
     
     try {
+        if (static_cast<int>(vertices.size()) > EXACT_ECCENTRICITY_LIMIT) {
+            DistanceBounds bounds = ShortestPath<int>::BoundDiameter(*currentGraph, 
+                ApproximationOptions(0.0, ECCENTRICITY_TIME_BUDGET));
+            wxString text = FormatDistanceBounds(wxT("Диаметр графа"), bounds);
+            
+            ClearResults();
+            resultsList->AppendColumn(wxT("Диаметр графа"), wxLIST_FORMAT_LEFT, 300);
+            resultsList->InsertItem(0, text);
+            LogMessage(wxT("Вычислен диаметр большого графа. ") + text);
+            return;
+        }
+        
         double diameter = SimpleGraphAlgorithms::GetGraphDiameter(vertices, edges, isDirected);
         
         ClearResults();
@@ -2317,6 +2260,18 @@ void MainWindow::OnGetRadius(wxCommandEvent& event) {
     }
     
     try {
+        if (static_cast<int>(vertices.size()) > EXACT_ECCENTRICITY_LIMIT) {
+            DistanceBounds bounds = ShortestPath<int>::BoundRadius(*currentGraph, 
+                ApproximationOptions(0.0, ECCENTRICITY_TIME_BUDGET));
+            wxString text = FormatDistanceBounds(wxT("Радиус графа"), bounds);
+            
+            ClearResults();
+            resultsList->AppendColumn(wxT("Радиус графа"), wxLIST_FORMAT_LEFT, 300);
+            resultsList->InsertItem(0, text);
+            LogMessage(wxT("Вычислен радиус большого графа. ") + text);
+            return;
+        }
+        
         double radius = SimpleGraphAlgorithms::GetGraphRadius(vertices, edges, isDirected);
         
         ClearResults();
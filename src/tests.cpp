@@ -7,13 +7,20 @@
 #include "core/structures/set.h"
 #include "core/structures/sorted_sequence.h"
 #include "core/structures/priority_queue.h"
+#include "core/structures/deque.h"
+#include "core/structures/thread_pool.h"
+#include "core/structures/disjoint_set.h"
 
 #include "core/graph/GraphBase.h"
 #include "core/graph/DirectedGraph.h"
 #include "core/graph/UndirectedGraph.h"
+#include "core/graph/CsrGraph.h"
 #include "core/tasks/ConnectedComponents.h"
 #include "core/tasks/PartialOrder.h"
+#include "core/tasks/StronglyConnectedComponents.h"
 #include "core/tasks/ShortestPath.h"
+#include "core/tasks/AllPairsShortestPaths.h"
+#include "core/tasks/MultiSourceBFS.h"
 #include "core/tasks/TopologicalSort.h"
 
 #include <functional>
@@ -22,6 +29,11 @@
 #include <string>
 #include <map>
 #include <unordered_set>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <cmath>
+#include <sstream>
 
 extern "C" 
 {
@@ -29,6 +41,35 @@ extern "C"
     void quick_exit(int status) { exit(status); }
 }
 
+// Замеры производительности оформлены как DISABLED_*Benchmark и в обычном прогоне пропускаются.
+// Запуск: tests --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+
+// Общий генератор случайных данных тестов: линейный конгруэнтный, одинаковый на всех платформах
+static unsigned int NextRandom(unsigned int& seed) 
+{
+    seed = seed * 1103515245u + 12345u;
+    return seed;
+}
+
+// Случайное число из [0, bound): младшие биты генератора слабые, поэтому они отбрасываются
+static int RandomBelow(unsigned int& seed, int bound) 
+{
+    return static_cast<int>((NextRandom(seed) >> 4) % static_cast<unsigned int>(bound));
+}
+
+// Случайный граф на вершинах 0..vertices-1: ребро k выходит из вершины k % vertices в случайную,
+// так что у каждой вершины около edges / vertices исходящих рёбер. Веса - целые из [1, maxWeight], при maxWeight = 0 все веса 1
+static void BuildRandomGraph(GraphBase<int>& graph, int vertices, int edges, unsigned int seed, int maxWeight = 0) 
+{
+    for (int v = 0; v < vertices; v++) graph.AddVertex(v);
+    for (int k = 0; k < edges; k++) 
+    {
+        int to = RandomBelow(seed, vertices);
+        double weight = maxWeight > 0 ? 1.0 + RandomBelow(seed, maxWeight) : 1.0;
+        graph.AddEdge(k % vertices, to, weight);
+    }
+}
+
 // 1. Тесты DynamicArray
 
 TEST(DynamicArrayTest, EmptyArray) 
@@ -265,6 +306,124 @@ TEST(DynamicArrayTest, LargeArrayPerformance)
     EXPECT_EQ(arr.Get(SIZE-1), (SIZE-1)*2);
 }
 
+TEST(DynamicArrayTest, PushBackReserveAndShrink) 
+{
+    // Проверяет: Ёмкость, резервирование, добавление в конец и освобождение памяти
+    DynamicArray<std::string> arr;
+    arr.Reserve(10);
+    EXPECT_EQ(arr.GetSize(), 0);
+    EXPECT_GE(arr.GetCapacity(), 10);
+
+    arr.PushBack("a");
+    std::string b = "b";
+    arr.PushBack(b);
+    arr.EmplaceBack(3, 'c');
+    EXPECT_EQ(arr.GetSize(), 3);
+    EXPECT_EQ(arr.Get(2), "ccc");
+
+    arr.PushBack(arr.Get(0));
+    EXPECT_EQ(arr.Get(3), "a");
+
+    arr.PopBack();
+    EXPECT_EQ(arr.GetSize(), 3);
+    arr.ShrinkToFit();
+    EXPECT_EQ(arr.GetCapacity(), 3);
+    EXPECT_EQ(arr.Get(1), "b");
+
+    arr.Resize(5);
+    EXPECT_EQ(arr.Get(4), "");
+    arr.Resize(1);
+    arr.Resize(2);
+    EXPECT_EQ(arr.Get(1), "");
+
+    arr.Clear();
+    EXPECT_EQ(arr.GetSize(), 0);
+}
+
+TEST(DynamicArrayTest, PushOwnElementWhenFull) 
+{
+    // Проверяет: Добавление собственного элемента в заполненный массив переживает перевыделение
+    DynamicArray<std::string> arr;
+    for (int i = 0; i < 4; i++) 
+    {
+        arr.PushBack("item" + std::to_string(i));
+    }
+    ASSERT_EQ(arr.GetCapacity(), arr.GetSize());
+    arr.PushBack(arr[0]);
+    EXPECT_EQ(arr.Get(4), "item0");
+
+    while (arr.GetSize() < arr.GetCapacity()) 
+    {
+        arr.PushBack("pad");
+    }
+    arr.PushBack(std::move(arr[1]));
+    EXPECT_EQ(arr.Get(arr.GetSize() - 1), "item1");
+
+    while (arr.GetSize() < arr.GetCapacity()) 
+    {
+        arr.PushBack("pad");
+    }
+    arr.EmplaceBack(arr[2]);
+    EXPECT_EQ(arr.Get(arr.GetSize() - 1), "item2");
+
+    DynamicArray<int> numbers;
+    for (int i = 0; i < 4; i++) 
+    {
+        numbers.PushBack(i + 10);
+    }
+    ASSERT_EQ(numbers.GetCapacity(), numbers.GetSize());
+    numbers.EmplaceBack(numbers[0]);
+    EXPECT_EQ(numbers.Get(4), 10);
+}
+
+TEST(DynamicArrayTest, GeometricGrowth) 
+{
+    // Проверяет: Без Reserve ёмкость растёт геометрически - O(log n) перевыделений, не больше 2n ячеек
+    const int COUNT = 100000;
+    DynamicArray<int> arr;
+    int reallocations = 0;
+    int lastCapacity = arr.GetCapacity();
+    for (int i = 0; i < COUNT; i++) 
+    {
+        arr.PushBack(i);
+        if (arr.GetCapacity() != lastCapacity) 
+        {
+            lastCapacity = arr.GetCapacity();
+            reallocations++;
+        }
+        ASSERT_LE(arr.GetCapacity(), 2 * arr.GetSize() + 4);
+    }
+    EXPECT_EQ(arr.GetSize(), COUNT);
+    EXPECT_LE(reallocations, 17);
+    EXPECT_EQ(arr.Get(COUNT - 1), COUNT - 1);
+}
+
+TEST(DynamicArrayTest, DISABLED_AppendTenMillionIntsBenchmark) 
+{
+    // Проверяет: Время добавления 10^7 элементов
+    const int COUNT = 10000000;
+    DynamicArray<int> arr;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < COUNT; i++) 
+    {
+        arr.PushBack(i);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "[ BENCH    ] PushBack of " << COUNT << " ints: " << elapsed.count() << " ms" << std::endl;
+
+    EXPECT_EQ(arr.GetSize(), COUNT);
+    EXPECT_EQ(arr.Get(COUNT - 1), COUNT - 1);
+
+    MutableArraySequence<int> sequence;
+    for (int i = 0; i < COUNT / 10; i++) 
+    {
+        sequence.Append(i);
+    }
+    EXPECT_EQ(sequence.GetLength(), COUNT / 10);
+    EXPECT_EQ(sequence.GetLast(), COUNT / 10 - 1);
+}
+
 // 2. Тесты LinkedList
 
 TEST(LinkedListTest, EmptyList) 
@@ -522,6 +681,115 @@ TEST(LinkedListTest, LargeLinkedList)
     EXPECT_EQ(list.Get(999), 999);
 }
 
+TEST(LinkedListTest, SpliceAndRemoveFirst) 
+{
+    // Проверяет: Перенос узлов между списками за O(1) и корректность хвоста после операций
+    LinkedList<int> first;
+    LinkedList<int> second;
+    first.Append(1);
+    first.Append(2);
+    second.Append(3);
+    second.Append(4);
+
+    first.Splice(second);
+    EXPECT_EQ(first.GetLength(), 4);
+    EXPECT_EQ(second.GetLength(), 0);
+    EXPECT_EQ(first.GetLast(), 4);
+    first.Append(5);
+    EXPECT_EQ(first.Get(4), 5);
+
+    LinkedList<int> prefix;
+    prefix.Append(0);
+    first.SpliceFront(prefix);
+    EXPECT_EQ(first.GetFirst(), 0);
+    EXPECT_EQ(first.GetLength(), 6);
+
+    second.Splice(first);
+    EXPECT_EQ(second.GetLength(), 6);
+    EXPECT_THROW(first.GetLast(), std::runtime_error);
+    for (int i = 0; i < 6; i++) 
+    {
+        EXPECT_EQ(second.RemoveFirst(), i);
+    }
+    EXPECT_THROW(second.RemoveFirst(), std::runtime_error);
+    second.Append(7);
+    EXPECT_EQ(second.GetFirst(), 7);
+    EXPECT_EQ(second.GetLast(), 7);
+
+    LinkedList<int> left;
+    LinkedList<int> right;
+    left.Append(1);
+    right.Append(2);
+    LinkedList<int> joined = LinkedList<int>::Concat(std::move(left), std::move(right));
+    EXPECT_EQ(joined.GetLength(), 2);
+    EXPECT_EQ(joined.GetLast(), 2);
+}
+
+TEST(LinkedListTest, PooledAllocatorReusesNodes) 
+{
+    // Проверяет: Список с пулом узлов ведёт себя так же, как обычный
+    LinkedList<std::string, PooledNodeAllocator> list;
+    for (int i = 0; i < 1000; i++) 
+    {
+        list.Append(std::to_string(i));
+    }
+    for (int i = 0; i < 500; i++) 
+    {
+        EXPECT_EQ(list.RemoveFirst(), std::to_string(i));
+    }
+    for (int i = 0; i < 500; i++) 
+    {
+        list.Prepend("p");
+    }
+    EXPECT_EQ(list.GetLength(), 1000);
+    EXPECT_EQ(list.GetFirst(), "p");
+    EXPECT_EQ(list.GetLast(), "999");
+
+    LinkedList<std::string, PooledNodeAllocator> copy(list);
+    LinkedList<std::string, PooledNodeAllocator> other;
+    other.Append("x");
+    copy.Splice(other);
+    EXPECT_EQ(copy.GetLength(), 1001);
+    EXPECT_EQ(copy.GetLast(), "x");
+}
+
+TEST(LinkedListTest, DISABLED_ListSequenceIterationBenchmark) 
+{
+    // Проверяет: Обход MutableListSequence итератором за линейное время
+    const int COUNT = 200000;
+    MutableListSequence<int> sequence;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < COUNT; i++) 
+    {
+        sequence.Append(i);
+    }
+    auto appendTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    long long sum = 0;
+    int visited = 0;
+    IIterator<int>* it = sequence.CreateIterator();
+    while (it->HasNext()) 
+    {
+        sum += it->GetCurrentItem();
+        visited++;
+        it->Next();
+    }
+    delete it;
+    auto iterateTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "[ BENCH    ] list of " << COUNT << ": append " << appendTime.count() << " ms, iterate " << iterateTime.count() << " ms" << std::endl;
+
+    EXPECT_EQ(visited, COUNT);
+    EXPECT_EQ(sum, static_cast<long long>(COUNT) * (COUNT - 1) / 2);
+
+    MutableListSequence<int> tail;
+    tail.Append(-1);
+    sequence.Splice(tail);
+    EXPECT_EQ(sequence.GetLength(), COUNT + 1);
+    EXPECT_EQ(sequence.GetLast(), -1);
+    EXPECT_EQ(tail.GetLength(), 0);
+}
+
 // 3. Тесты Sequence
 
 TEST(SequenceTest, ImmutableArraySequenceBasicOperations) 
@@ -1056,6 +1324,117 @@ TEST(BinaryTreeTest, TreeBalanceEmpty)
     EXPECT_TRUE(tree.isEmpty());
 }
 
+TEST(BinaryTreeTest, AVLTreeSortedInsertKeepsLogHeight) 
+{
+    // Проверяет: Высоту AVL-дерева при вставке и удалении упорядоченных ключей
+    AVLTree<int> tree;
+    const int COUNT = 1000;
+
+    for (int i = 1; i <= COUNT; i++) 
+    {
+        tree.insert(i);
+    }
+
+    EXPECT_LE(tree.getHeight(), 1.45 * std::log2(COUNT + 2.0));
+
+    for (int i = 1; i <= COUNT; i += 2) 
+    {
+        tree.remove(i);
+    }
+
+    EXPECT_LE(tree.getHeight(), 1.45 * std::log2(COUNT / 2 + 2.0));
+
+    std::vector<int> inOrder;
+    tree.traverseInOrder([&](int value) 
+    {
+        inOrder.push_back(value);
+    });
+    ASSERT_EQ(inOrder.size(), COUNT / 2);
+    for (int i = 0; i < COUNT / 2; i++) 
+    {
+        EXPECT_EQ(inOrder[i], 2 * (i + 1));
+    }
+}
+
+TEST(BinaryTreeTest, DISABLED_AVLTreeMillionSortedKeysBenchmark) 
+{
+    // Проверяет: Вставку 10^6 упорядоченных ключей в сбалансированное дерево
+    AVLTree<int> tree;
+    const int COUNT = 1000000;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < COUNT; i++) 
+    {
+        tree.insert(i);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "[ BENCH    ] AVLTree sorted insert of " << COUNT << " keys: " << elapsed.count() << " ms, height " << tree.getHeight() << std::endl;
+
+    EXPECT_LE(tree.getHeight(), 1.45 * std::log2(COUNT + 2.0));
+    EXPECT_TRUE(tree.contains(0));
+    EXPECT_TRUE(tree.contains(COUNT - 1));
+    EXPECT_FALSE(tree.contains(COUNT));
+}
+
+TEST(BinaryTreeTest, OrderStatisticsSelectAndRank) 
+{
+    // Проверяет: Подсчёт элементов, выбор k-го элемента и ранг через размеры поддеревьев
+    AVLTree<int> tree;
+    for (int i = 0; i < 100; i++) 
+    {
+        tree.insert((i * 37) % 100);
+    }
+    tree.insert(5);
+
+    EXPECT_EQ(tree.getCount(), 100);
+    for (int k = 0; k < 100; k++) 
+    {
+        EXPECT_EQ(tree.select(k), k);
+        EXPECT_EQ(tree.rank(k), k);
+    }
+    EXPECT_THROW(tree.select(100), std::out_of_range);
+
+    tree.remove(50);
+    EXPECT_EQ(tree.getCount(), 99);
+    EXPECT_EQ(tree.select(50), 51);
+    EXPECT_EQ(tree.rank(51), 50);
+
+    BinaryTree<int> plain;
+    plain.insert(2);
+    plain.insert(1);
+    plain.insert(3);
+    BinaryTree<int> copy = plain;
+    EXPECT_EQ(copy.getCount(), 3);
+    EXPECT_EQ(copy.select(2), 3);
+}
+
+TEST(BinaryTreeTest, SortedSequenceIndexAccess) 
+{
+    // Проверяет: Доступ по индексу и IndexOf в сортированной последовательности
+    SortedSequence<int> sequence;
+    sequence.Add(30);
+    sequence.Add(10);
+    sequence.Add(20);
+    sequence.Add(10);
+
+    EXPECT_EQ(sequence.GetLength(), 3);
+    EXPECT_EQ(sequence.GetFirst(), 10);
+    EXPECT_EQ(sequence.GetLast(), 30);
+    EXPECT_EQ(sequence.Get(1), 20);
+    EXPECT_EQ(sequence.IndexOf(30), 2);
+    EXPECT_EQ(sequence.IndexOf(25), -1);
+
+    auto sub = sequence.GetSubsequence(1, 2);
+    EXPECT_EQ(sub->GetLength(), 2);
+    EXPECT_EQ(sub->Get(0), 20);
+    delete sub;
+
+    sequence.Remove(10);
+    EXPECT_EQ(sequence.GetFirst(), 20);
+    EXPECT_EQ(sequence.IndexOf(30), 1);
+    EXPECT_THROW(sequence.Get(2), std::out_of_range);
+}
+
 TEST(BinaryTreeTest, TreeCopyConstructor) 
 {
     // Проверяет: Конструктор копирования для дерева
@@ -1448,6 +1827,52 @@ TEST(BinaryTreeTest, StringBinaryTreeOperations)
     EXPECT_FALSE(uppercaseTree.contains("apple"));
 }
 
+TEST(BinaryTreeTest, DegenerateTreeWithoutRecursion) 
+{
+    // Проверяет: Вставка, поиск, обходы, копирование, сериализация и удаление на вырожденном дереве глубины 30000
+    const int COUNT = 30000;
+    BinaryTree<int> tree;
+    for (int i = 0; i < COUNT; i++) 
+    {
+        tree.insert(i);
+    }
+    EXPECT_EQ(tree.getHeight(), COUNT);
+    EXPECT_EQ(tree.getCount(), COUNT);
+    EXPECT_TRUE(tree.contains(COUNT - 1));
+    EXPECT_FALSE(tree.contains(COUNT));
+
+    long long expected = static_cast<long long>(COUNT) * (COUNT - 1) / 2;
+    long long sum = 0;
+    int previous = -1;
+    bool ordered = true;
+    tree.traverseInOrder([&](int value) 
+    {
+        ordered = ordered && value == previous + 1;
+        previous = value;
+        sum += value;
+    });
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(sum, expected);
+    int first = -1;
+    tree.traversePostOrder([&](int value) { if (first == -1) first = value; });
+    EXPECT_EQ(first, COUNT - 1);
+
+    BinaryTree<int> copy(tree);
+    EXPECT_EQ(copy.getHeight(), COUNT);
+    EXPECT_EQ(copy.serialize().GetSize(), tree.serialize().GetSize());
+
+    for (int i = 0; i < COUNT; i += 2) 
+    {
+        copy.remove(i);
+    }
+    EXPECT_EQ(copy.getCount(), COUNT / 2);
+    EXPECT_EQ(copy.select(0), 1);
+    EXPECT_FALSE(copy.contains(COUNT - 2));
+
+    tree.clear();
+    EXPECT_TRUE(tree.isEmpty());
+}
+
 // 5. Тесты Dictionary с простыми типами
 
 TEST(DictionaryTest, EmptyDictionaryOperations) 
@@ -1656,85 +2081,556 @@ TEST(DictionaryTest, LargeDictionaryOperations)
     }
 }
 
-// 6. Тесты для графов
+TEST(DictionaryTest, InPlaceAccessOperations) 
+{
+    // Проверяет: TryGet, GetOrInsert, Upsert и Emplace без копирования значений
+    Dictionary<int, Dictionary<int, double>> nested;
 
-TEST(GraphTest, DirectedGraphBasicOperations) 
+    EXPECT_EQ(nested.TryGet(1), nullptr);
+    EXPECT_TRUE(nested.Emplace(1));
+    EXPECT_FALSE(nested.Emplace(1));
+
+    nested.GetOrInsert(1).Add(10, 1.5);
+    nested.GetOrInsert(2).Add(20, 2.5);
+    EXPECT_EQ(nested.GetCount(), 2);
+
+    Dictionary<int, double>* inner = nested.TryGet(1);
+    ASSERT_NE(inner, nullptr);
+    EXPECT_TRUE(inner->Upsert(11, 3.0));
+    EXPECT_FALSE(inner->Upsert(11, 4.0));
+    *inner->TryGet(10) = 7.0;
+
+    EXPECT_EQ(nested.Get(1).Get(10), 7.0);
+    EXPECT_EQ(nested.Get(1).Get(11), 4.0);
+    EXPECT_EQ(nested.Get(2).Get(20), 2.5);
+
+    Dictionary<int, std::string> strings;
+    EXPECT_TRUE(strings.Emplace(5, 3, 'x'));
+    EXPECT_EQ(strings.Get(5), "xxx");
+
+    const Dictionary<int, std::string>& constStrings = strings;
+    ASSERT_NE(constStrings.TryGet(5), nullptr);
+    EXPECT_EQ(*constStrings.TryGet(5), "xxx");
+}
+
+// Значение, считающее копирования заполненных экземпляров (значение по умолчанию, которым
+// словарь заполняет пару для поиска, не считается)
+struct CopyCountingValue 
 {
-    // Проверяет: Базовые операции ориентированного графа
-    DirectedGraph<int> graph;
-    
-    graph.AddVertex(1);
-    graph.AddVertex(2);
-    graph.AddVertex(3);
-    
-    EXPECT_TRUE(graph.HasVertex(1));
-    EXPECT_TRUE(graph.HasVertex(2));
-    EXPECT_TRUE(graph.HasVertex(3));
-    EXPECT_FALSE(graph.HasVertex(4));
-    
-    graph.AddEdge(1, 2);
-    graph.AddEdge(1, 3);
-    graph.AddEdge(2, 3);
-    
-    EXPECT_TRUE(graph.HasEdge(1, 2));
-    EXPECT_TRUE(graph.HasEdge(1, 3));
-    EXPECT_TRUE(graph.HasEdge(2, 3));
-    EXPECT_FALSE(graph.HasEdge(2, 1));
-    EXPECT_FALSE(graph.HasEdge(3, 1));
-    
-    EXPECT_EQ(graph.GetVertexCount(), 3);
-    EXPECT_EQ(graph.GetEdgeCount(), 3);
-    
-    auto adj1 = graph.GetAdjacentVertices(1);
-    EXPECT_EQ(adj1->GetLength(), 2);
-    delete adj1;
-    
-    EXPECT_TRUE(graph.IsDirected());
+    static int copies;
+    int payload;
+
+    CopyCountingValue(int payload = -1) : payload(payload) {}
+    CopyCountingValue(const CopyCountingValue& other) : payload(other.payload) 
+    {
+        if (payload >= 0) copies++;
+    }
+    CopyCountingValue& operator=(const CopyCountingValue& other) 
+    {
+        payload = other.payload;
+        if (payload >= 0) copies++;
+        return *this;
+    }
+};
+
+int CopyCountingValue::copies = 0;
+
+TEST(DictionaryTest, RemovalKeepsOtherValuesInPlace) 
+{
+    // Проверяет: Удаление ключа не перемещает и не копирует значения остальных ключей, указатели TryGet остаются действительными
+    Dictionary<int, int> small;
+    for (int key : { 4, 2, 6, 1, 3, 5, 7 }) 
+    {
+        small.Add(key, key * 10);
+    }
+    int* five = small.TryGet(5);
+    small.Remove(4);
+    EXPECT_EQ(small.TryGet(5), five);
+    EXPECT_EQ(*five, 50);
+
+    const int KEYS = 2000;
+    Dictionary<int, CopyCountingValue> values;
+    for (int key = 0; key < KEYS; key++) 
+    {
+        values.GetOrInsert(key).payload = key;
+    }
+    DynamicArray<CopyCountingValue*> pointers(KEYS);
+    for (int key = 0; key < KEYS; key++) 
+    {
+        pointers[key] = values.TryGet(key);
+    }
+    CopyCountingValue::copies = 0;
+    // Удаляются ключи с двумя детьми и без: каждый третий, затем каждый пятый из оставшихся
+    for (int key = 0; key < KEYS; key += 3) 
+    {
+        values.Remove(key);
+    }
+    for (int key = 1; key < KEYS; key += 5) 
+    {
+        if (key % 3 != 0) values.Remove(key);
+    }
+    EXPECT_EQ(CopyCountingValue::copies, 0);
+    int moved = 0;
+    for (int key = 0; key < KEYS; key++) 
+    {
+        bool removed = key % 3 == 0 || key % 5 == 1;
+        CopyCountingValue* current = values.TryGet(key);
+        if (removed ? current != nullptr : (current != pointers[key] || current->payload != key)) moved++;
+    }
+    EXPECT_EQ(moved, 0);
 }
 
-TEST(GraphTest, DirectedGraphEdgeWeights) 
+TEST(DictionaryTest, HashStorageInPlaceAccess) 
 {
-    // Проверяет: Веса ребер в ориентированном графе
-    DirectedGraph<std::string> graph;
-    
-    graph.AddVertex("A");
-    graph.AddVertex("B");
-    graph.AddVertex("C");
-    
-    graph.AddEdge("A", "B", 5.0);
-    graph.AddEdge("B", "C", 3.0);
-    graph.AddEdge("A", "C", 10.0);
-    
-    EXPECT_EQ(graph.GetEdgeWeight("A", "B"), 5.0);
-    EXPECT_EQ(graph.GetEdgeWeight("B", "C"), 3.0);
-    EXPECT_EQ(graph.GetEdgeWeight("A", "C"), 10.0);
-    
-    graph.SetEdgeWeight("A", "B", 7.0);
-    EXPECT_EQ(graph.GetEdgeWeight("A", "B"), 7.0);
-    
-    EXPECT_THROW(graph.GetEdgeWeight("C", "A"), std::runtime_error);
+    // Проверяет: Доступ по ссылке к значениям хеш-словаря
+    Dictionary<int, int, HashStorage> dict;
+    for (int i = 0; i < 100; i++) 
+    {
+        dict.GetOrInsert(i % 10) += 1;
+    }
+    EXPECT_EQ(dict.GetCount(), 10);
+    EXPECT_EQ(dict.Get(3), 10);
+    EXPECT_TRUE(dict.Upsert(42, 1));
+    EXPECT_FALSE(dict.Upsert(42, 2));
+    EXPECT_EQ(*dict.TryGet(42), 2);
+    EXPECT_FALSE(dict.Emplace(42, 5));
+    EXPECT_EQ(dict.TryGet(43), nullptr);
 }
 
-TEST(GraphTest, DirectedGraphRemoveOperations) 
+TEST(DictionaryTest, HashStorageBasicOperations) 
 {
-    // Проверяет: Удаление вершин и ребер в ориентированном графе
-    DirectedGraph<int> graph;
-    
-    graph.AddVertex(1);
-    graph.AddVertex(2);
-    graph.AddVertex(3);
-    graph.AddVertex(4);
-    
-    graph.AddEdge(1, 2);
-    graph.AddEdge(1, 3);
-    graph.AddEdge(2, 3);
-    graph.AddEdge(3, 4);
-    
-    EXPECT_EQ(graph.GetEdgeCount(), 4);
-    
-    graph.RemoveEdge(1, 3);
-    EXPECT_FALSE(graph.HasEdge(1, 3));
-    EXPECT_EQ(graph.GetEdgeCount(), 3);
+    // Проверяет: Словарь на хеш-таблице с открытой адресацией
+    Dictionary<int, std::string, HashStorage> dict;
+    EXPECT_TRUE(dict.IsEmpty());
+
+    dict.Add(1, "One");
+    dict.Add(2, "Two");
+    dict.Add(1, "Uno");
+
+    EXPECT_EQ(dict.GetCount(), 2);
+    EXPECT_EQ(dict.Get(1), "Uno");
+    EXPECT_EQ(dict.Get(2), "Two");
+    EXPECT_FALSE(dict.ContainsKey(3));
+    EXPECT_THROW(dict.Get(3), std::runtime_error);
+    EXPECT_TRUE(dict.ContainsValue("Two"));
+
+    dict.Remove(1);
+    EXPECT_FALSE(dict.ContainsKey(1));
+    EXPECT_EQ(dict.GetCount(), 1);
+
+    dict.Clear();
+    EXPECT_TRUE(dict.IsEmpty());
+}
+
+TEST(DictionaryTest, HashStorageGrowthAndRemoval) 
+{
+    // Проверяет: Перехеширование и удаление со сдвигом в хеш-таблице
+    Dictionary<int, int, HashStorage> dict;
+    const int COUNT = 20000;
+
+    for (int i = 0; i < COUNT; i++) 
+    {
+        dict.Add(i * 7, i);
+    }
+    EXPECT_EQ(dict.GetCount(), COUNT);
+
+    for (int i = 0; i < COUNT; i += 3) 
+    {
+        dict.Remove(i * 7);
+    }
+
+    int expectedCount = 0;
+    for (int i = 0; i < COUNT; i++) 
+    {
+        if (i % 3 == 0) 
+        {
+            EXPECT_FALSE(dict.ContainsKey(i * 7));
+        }
+        else 
+        {
+            expectedCount++;
+            ASSERT_TRUE(dict.ContainsKey(i * 7));
+            EXPECT_EQ(dict.Get(i * 7), i);
+        }
+    }
+    EXPECT_EQ(dict.GetCount(), expectedCount);
+
+    int visited = 0;
+    dict.ForEach([&](int key, int value) 
+    {
+        visited++;
+        EXPECT_EQ(key, value * 7);
+    });
+    EXPECT_EQ(visited, expectedCount);
+
+    auto keys = dict.GetKeys();
+    EXPECT_EQ(keys->GetLength(), expectedCount);
+    delete keys;
+}
+
+TEST(DictionaryTest, HashStorageStringKeys) 
+{
+    // Проверяет: Хеш-словарь со строковыми ключами и его копирование
+    Dictionary<std::string, int, HashStorage> dict;
+    dict.Add("apple", 1);
+    dict.Add("banana", 2);
+
+    Dictionary<std::string, int, HashStorage> copy = dict;
+    dict.Add("apple", 10);
+
+    EXPECT_EQ(copy.Get("apple"), 1);
+    EXPECT_EQ(dict.Get("apple"), 10);
+    EXPECT_EQ(copy.GetCount(), 2);
+}
+
+TEST(DictionaryTest, HashSetOperations) 
+{
+    // Проверяет: Множество на хеш-таблице
+    Set<int, HashStorage> set1;
+    Set<int, HashStorage> set2;
+    for (int i = 0; i < 10; i++) 
+    {
+        set1.Add(i);
+        set1.Add(i);
+    }
+    for (int i = 5; i < 15; i++) 
+    {
+        set2.Add(i);
+    }
+
+    EXPECT_EQ(set1.GetCount(), 10);
+    EXPECT_EQ(set1.Union(set2).GetCount(), 15);
+    EXPECT_EQ(set1.Intersection(set2).GetCount(), 5);
+    EXPECT_EQ(set1.Difference(set2).GetCount(), 5);
+
+    set1.Remove(3);
+    EXPECT_FALSE(set1.Contains(3));
+    EXPECT_TRUE(set1.Contains(4));
+}
+
+TEST(PriorityQueueTest, DuplicatePrioritiesAreKept) 
+{
+    // Проверяет: Очередь с приоритетами на d-арной куче хранит равные элементы
+    PriorityQueue<int> queue;
+    int values[] = {5, 1, 5, 3, 9, 1, 7};
+    for (int value : values) 
+    {
+        queue.Enqueue(value);
+    }
+
+    EXPECT_EQ(queue.GetCount(), 7);
+    EXPECT_EQ(queue.Peek(), 9);
+
+    int expected[] = {9, 7, 5, 5, 3, 1, 1};
+    for (int value : expected) 
+    {
+        EXPECT_EQ(queue.Dequeue(), value);
+    }
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_THROW(queue.Dequeue(), std::runtime_error);
+}
+
+TEST(PriorityQueueTest, CustomComparatorAndArity) 
+{
+    // Проверяет: Порядок извлечения с пользовательским компаратором и бинарной кучей
+    PriorityQueue<int, 2> queue([](const int& a, const int& b) { return a > b; });
+    for (int i = 1000; i > 0; i--) 
+    {
+        queue.Enqueue((i * 7919) % 1000);
+    }
+
+    int previous = queue.Dequeue();
+    while (!queue.IsEmpty()) 
+    {
+        int current = queue.Dequeue();
+        EXPECT_LE(previous, current);
+        previous = current;
+    }
+}
+
+TEST(PriorityQueueTest, IndexedHeapDecreaseKey) 
+{
+    // Проверяет: Индексированную кучу с уменьшением ключа
+    IndexedPriorityQueue<double> heap(5);
+    heap.Push(0, 10.0);
+    heap.Push(1, 5.0);
+    heap.Push(2, 7.0);
+    heap.Push(3, 1.0);
+
+    EXPECT_THROW(heap.Push(1, 2.0), std::runtime_error);
+    EXPECT_THROW(heap.DecreaseKey(2, 8.0), std::invalid_argument);
+
+    heap.DecreaseKey(0, 0.5);
+    EXPECT_FALSE(heap.PushOrDecrease(2, 9.0));
+    EXPECT_TRUE(heap.PushOrDecrease(4, 6.0));
+
+    EXPECT_EQ(heap.Pop(), 0);
+    EXPECT_EQ(heap.Pop(), 3);
+    EXPECT_EQ(heap.Pop(), 1);
+    EXPECT_EQ(heap.PeekPriority(), 6.0);
+    EXPECT_EQ(heap.Pop(), 4);
+    EXPECT_EQ(heap.Pop(), 2);
+    EXPECT_TRUE(heap.IsEmpty());
+    EXPECT_FALSE(heap.Contains(0));
+}
+
+TEST(DequeTest, RingBufferWrapAroundAndGrowth) 
+{
+    // Проверяет: Операции с обоих концов кольцевого буфера, переход через границу и рост
+    Deque<int> deque;
+    for (int i = 0; i < 6; i++) 
+    {
+        deque.PushBack(i);
+    }
+    EXPECT_EQ(deque.PopFront(), 0);
+    EXPECT_EQ(deque.PopFront(), 1);
+    deque.PushBack(6);
+    deque.PushBack(7);
+    deque.PushBack(8);
+    deque.PushFront(1);
+    deque.PushFront(0);
+
+    for (int i = 9; i < 40; i++) 
+    {
+        deque.PushBack(i);
+    }
+
+    EXPECT_EQ(deque.GetCount(), 40);
+    for (int i = 0; i < 40; i++) 
+    {
+        EXPECT_EQ(deque.Get(i), i);
+    }
+    EXPECT_EQ(deque.Front(), 0);
+    EXPECT_EQ(deque.Back(), 39);
+    EXPECT_EQ(deque.PopBack(), 39);
+    EXPECT_EQ(deque.PopFront(), 0);
+
+    deque.Clear();
+    EXPECT_TRUE(deque.IsEmpty());
+    EXPECT_THROW(deque.PopFront(), std::runtime_error);
+    EXPECT_THROW(deque.Back(), std::runtime_error);
+}
+
+TEST(DequeTest, PushOwnElementWhenFull) 
+{
+    // Проверяет: Добавление в заполненную очередь ссылки на её собственный элемент переживает рост буфера
+    Deque<std::string> deque;
+    for (int i = 0; i < 8; i++) 
+    {
+        deque.PushBack("item" + std::to_string(i));
+    }
+    deque.PushBack(deque.Back());
+    EXPECT_EQ(deque.GetCount(), 9);
+    EXPECT_EQ(deque.Back(), "item7");
+
+    while (deque.GetCount() < 16) 
+    {
+        deque.PushBack("pad");
+    }
+    deque.PushFront(deque.Front());
+    EXPECT_EQ(deque.Front(), "item0");
+
+    while (deque.GetCount() < 32) 
+    {
+        deque.PushBack("pad");
+    }
+    deque.PushBack(deque.Front());
+    EXPECT_EQ(deque.Back(), "item0");
+
+    while (deque.GetCount() < 64) 
+    {
+        deque.PushBack("pad");
+    }
+    std::string last = deque.Back();
+    deque.PushFront(deque.Back());
+    EXPECT_EQ(deque.Front(), last);
+    EXPECT_EQ(deque.GetCount(), 65);
+    EXPECT_EQ(deque.Get(1), "item0");
+    EXPECT_EQ(deque.Get(2), "item0");
+}
+
+TEST(DequeTest, GraphStackAndQueue) 
+{
+    // Проверяет: Порядок извлечения в Stack и Queue из GraphBase.h
+    Stack<int> stack;
+    Queue<int> queue;
+    for (int i = 0; i < 100; i++) 
+    {
+        stack.Push(i);
+        queue.Enqueue(i);
+    }
+    EXPECT_EQ(stack.Size(), 100);
+    EXPECT_EQ(queue.Size(), 100);
+    EXPECT_EQ(stack.Top(), 99);
+    EXPECT_EQ(queue.Front(), 0);
+
+    for (int i = 0; i < 100; i++) 
+    {
+        EXPECT_EQ(stack.Pop(), 99 - i);
+        EXPECT_EQ(queue.Dequeue(), i);
+    }
+    EXPECT_TRUE(stack.IsEmpty());
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_THROW(stack.Pop(), std::runtime_error);
+    EXPECT_THROW(queue.Dequeue(), std::runtime_error);
+}
+
+TEST(DisjointSetTest, UnionFindWithSizes) 
+{
+    // Проверяет: Объединение, поиск представителя, размеры и число множеств, рост и ошибки индекса
+    DisjointSet sets(6);
+    EXPECT_EQ(sets.GetSetCount(), 6);
+    EXPECT_TRUE(sets.Union(0, 1));
+    EXPECT_TRUE(sets.Union(2, 3));
+    EXPECT_TRUE(sets.Union(1, 3));
+    EXPECT_FALSE(sets.Union(0, 2));
+    EXPECT_EQ(sets.GetSetCount(), 3);
+    EXPECT_TRUE(sets.AreConnected(0, 3));
+    EXPECT_FALSE(sets.AreConnected(0, 4));
+    EXPECT_EQ(sets.GetSetSize(2), 4);
+    EXPECT_EQ(sets.GetSetSize(5), 1);
+    EXPECT_EQ(sets.Find(0), sets.Find(3));
+
+    int added = sets.AddElement();
+    EXPECT_EQ(added, 6);
+    EXPECT_EQ(sets.GetSetCount(), 4);
+    sets.Union(added, 5);
+    EXPECT_EQ(sets.GetSetSize(5), 2);
+    EXPECT_THROW(sets.Find(7), std::out_of_range);
+
+    // Длинная цепочка объединений не вырождается: после Find путь сжат до корня
+    DisjointSet chain(100000);
+    for (int i = 1; i < 100000; i++) 
+    {
+        chain.Union(i - 1, i);
+    }
+    EXPECT_EQ(chain.GetSetCount(), 1);
+    EXPECT_EQ(chain.GetSetSize(0), 100000);
+    EXPECT_TRUE(chain.AreConnected(0, 99999));
+}
+
+TEST(ThreadPoolTest, ParallelForCoversRangeAndRethrows) 
+{
+    // Проверяет: Каждый индекс обрабатывается ровно один раз, номер потока в пределах пула, исключение доходит до вызывающего
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.GetThreadCount(), 4);
+
+    const int COUNT = 10000;
+    std::vector<int> visits(COUNT, 0);
+    std::vector<long long> perWorker(pool.GetThreadCount(), 0);
+    pool.ParallelFor(0, COUNT, [&](int i, int worker) 
+    {
+        visits[i]++;
+        perWorker[worker] += i;
+    });
+    long long total = 0;
+    for (long long part : perWorker) total += part;
+    EXPECT_EQ(total, static_cast<long long>(COUNT) * (COUNT - 1) / 2);
+    EXPECT_EQ(std::count(visits.begin(), visits.end(), 1), COUNT);
+
+    // Вложенный цикл выполняется в том же потоке
+    std::vector<int> nested(16, 0);
+    pool.ParallelFor(0, 4, [&](int i, int) 
+    {
+        pool.ParallelFor(0, 4, [&](int j, int) { nested[i * 4 + j]++; });
+    });
+    EXPECT_EQ(std::count(nested.begin(), nested.end(), 1), 16);
+
+    EXPECT_THROW(pool.ParallelFor(0, 100, [](int i, int) 
+    {
+        if (i == 57) throw std::runtime_error("failure");
+    }), std::runtime_error);
+
+    // После ошибки пул остаётся рабочим
+    int sum = 0;
+    std::mutex sumMutex;
+    pool.ParallelFor(0, 10, [&](int i, int) 
+    {
+        std::lock_guard<std::mutex> lock(sumMutex);
+        sum += i;
+    });
+    EXPECT_EQ(sum, 45);
+}
+
+// 6. Тесты для графов
+
+TEST(GraphTest, DirectedGraphBasicOperations) 
+{
+    // Проверяет: Базовые операции ориентированного графа
+    DirectedGraph<int> graph;
+    
+    graph.AddVertex(1);
+    graph.AddVertex(2);
+    graph.AddVertex(3);
+    
+    EXPECT_TRUE(graph.HasVertex(1));
+    EXPECT_TRUE(graph.HasVertex(2));
+    EXPECT_TRUE(graph.HasVertex(3));
+    EXPECT_FALSE(graph.HasVertex(4));
+    
+    graph.AddEdge(1, 2);
+    graph.AddEdge(1, 3);
+    graph.AddEdge(2, 3);
+    
+    EXPECT_TRUE(graph.HasEdge(1, 2));
+    EXPECT_TRUE(graph.HasEdge(1, 3));
+    EXPECT_TRUE(graph.HasEdge(2, 3));
+    EXPECT_FALSE(graph.HasEdge(2, 1));
+    EXPECT_FALSE(graph.HasEdge(3, 1));
+    
+    EXPECT_EQ(graph.GetVertexCount(), 3);
+    EXPECT_EQ(graph.GetEdgeCount(), 3);
+    
+    auto adj1 = graph.GetAdjacentVertices(1);
+    EXPECT_EQ(adj1->GetLength(), 2);
+    delete adj1;
+    
+    EXPECT_TRUE(graph.IsDirected());
+}
+
+TEST(GraphTest, DirectedGraphEdgeWeights) 
+{
+    // Проверяет: Веса ребер в ориентированном графе
+    DirectedGraph<std::string> graph;
+    
+    graph.AddVertex("A");
+    graph.AddVertex("B");
+    graph.AddVertex("C");
+    
+    graph.AddEdge("A", "B", 5.0);
+    graph.AddEdge("B", "C", 3.0);
+    graph.AddEdge("A", "C", 10.0);
+    
+    EXPECT_EQ(graph.GetEdgeWeight("A", "B"), 5.0);
+    EXPECT_EQ(graph.GetEdgeWeight("B", "C"), 3.0);
+    EXPECT_EQ(graph.GetEdgeWeight("A", "C"), 10.0);
+    
+    graph.SetEdgeWeight("A", "B", 7.0);
+    EXPECT_EQ(graph.GetEdgeWeight("A", "B"), 7.0);
+    
+    EXPECT_THROW(graph.GetEdgeWeight("C", "A"), std::runtime_error);
+}
+
+TEST(GraphTest, DirectedGraphRemoveOperations) 
+{
+    // Проверяет: Удаление вершин и ребер в ориентированном графе
+    DirectedGraph<int> graph;
+    
+    graph.AddVertex(1);
+    graph.AddVertex(2);
+    graph.AddVertex(3);
+    graph.AddVertex(4);
+    
+    graph.AddEdge(1, 2);
+    graph.AddEdge(1, 3);
+    graph.AddEdge(2, 3);
+    graph.AddEdge(3, 4);
+    
+    EXPECT_EQ(graph.GetEdgeCount(), 4);
+    
+    graph.RemoveEdge(1, 3);
+    EXPECT_FALSE(graph.HasEdge(1, 3));
+    EXPECT_EQ(graph.GetEdgeCount(), 3);
     
     graph.RemoveVertex(3);
     EXPECT_FALSE(graph.HasVertex(3));
@@ -1819,58 +2715,386 @@ TEST(GraphTest, UndirectedGraphRemoveOperations)
     EXPECT_EQ(graph.GetVertexCount(), 3);
 }
 
-TEST(GraphTest, GraphSerializationDirected) 
+TEST(GraphTest, DirectedGraphRemoveVertexDropsIncomingEdges) 
 {
-    // Проверяет: Сериализацию и десериализацию ориентированного графа
+    // Проверяет: Удаление входящих рёбер вместе с вершиной
     DirectedGraph<int> graph;
-    
-    graph.AddEdge(1, 2, 1.0);
-    graph.AddEdge(1, 3, 2.0);
-    graph.AddEdge(2, 3, 3.0);
-    
-    std::stringstream ss;
-    graph.SerializeToStream(ss);
-    
-    auto deserialized = DirectedGraph<int>::DeserializeFromStream(ss);
-    
-    EXPECT_EQ(deserialized->GetVertexCount(), 3);
-    EXPECT_EQ(deserialized->GetEdgeCount(), 3);
-    EXPECT_TRUE(deserialized->HasEdge(1, 2));
-    EXPECT_TRUE(deserialized->HasEdge(1, 3));
-    EXPECT_TRUE(deserialized->HasEdge(2, 3));
-    EXPECT_EQ(deserialized->GetEdgeWeight(2, 3), 3.0);
-    
-    delete deserialized;
+    graph.AddEdge(1, 3);
+    graph.AddEdge(2, 3);
+    graph.AddEdge(3, 4);
+
+    graph.RemoveVertex(3);
+
+    EXPECT_EQ(graph.GetEdgeCount(), 0);
+    EXPECT_FALSE(graph.HasEdge(1, 3));
+    auto adj = graph.GetAdjacentVertices(1);
+    EXPECT_EQ(adj->GetLength(), 0);
+    delete adj;
 }
 
-TEST(GraphTest, GraphSerializationUndirected) 
+TEST(GraphTest, DirectedGraphInEdgesAndDegrees) 
 {
-    // Проверяет: Сериализацию и десериализацию неориентированного графа
-    UndirectedGraph<int> graph;
-    
-    graph.AddEdge(1, 2, 1.0);
+    // Проверяет: Список входящих рёбер и счётчики степеней при добавлении, изменении и удалении рёбер
+    DirectedGraph<int> graph;
     graph.AddEdge(1, 3, 2.0);
-    graph.AddEdge(2, 3, 3.0);
-    
-    std::stringstream ss;
-    graph.SerializeToStream(ss);
-    
-    auto deserialized = UndirectedGraph<int>::DeserializeFromStream(ss);
-    
-    EXPECT_EQ(deserialized->GetVertexCount(), 3);
-    EXPECT_EQ(deserialized->GetEdgeCount(), 3);
-    EXPECT_TRUE(deserialized->HasEdge(1, 2));
-    EXPECT_TRUE(deserialized->HasEdge(1, 3));
-    EXPECT_TRUE(deserialized->HasEdge(2, 3));
-    EXPECT_EQ(deserialized->GetEdgeWeight(2, 3), 3.0);
-    
-    delete deserialized;
-}
+    graph.AddEdge(2, 3, 5.0);
+    graph.AddEdge(3, 3, 1.0);
+    graph.AddEdge(3, 4);
 
-// 7. Тесты для ConnectedComponents
+    EXPECT_EQ(graph.InDegree(3), 3);
+    EXPECT_EQ(graph.OutDegree(3), 2);
+    EXPECT_EQ(graph.InDegree(1), 0);
+    EXPECT_EQ(graph.OutDegree(4), 0);
 
-TEST(ConnectedComponentsTest, EmptyGraph) 
-{
+    auto incoming = graph.GetIncomingVertices(3);
+    ASSERT_EQ(incoming->GetLength(), 2);
+    EXPECT_EQ(incoming->Get(0), 1);
+    EXPECT_EQ(incoming->Get(1), 2);
+    delete incoming;
+
+    graph.SetEdgeWeight(2, 3, 7.0);
+    double incomingWeight = 0.0;
+    graph.ForEachEdgeTo(3, [&](const int&, double weight) { incomingWeight += weight; });
+    EXPECT_EQ(incomingWeight, 10.0);
+
+    graph.RemoveEdge(1, 3);
+    EXPECT_EQ(graph.InDegree(3), 2);
+    EXPECT_EQ(graph.OutDegree(1), 0);
+
+    graph.RemoveVertex(3);
+    EXPECT_EQ(graph.GetEdgeCount(), 0);
+    EXPECT_EQ(graph.OutDegree(2), 0);
+    EXPECT_EQ(graph.InDegree(4), 0);
+    EXPECT_THROW(graph.InDegree(3), std::runtime_error);
+
+    DirectedGraph<int> copy(graph);
+    copy.AddEdge(4, 2);
+    EXPECT_EQ(copy.InDegree(2), 1);
+    EXPECT_EQ(graph.InDegree(2), 0);
+}
+
+TEST(GraphTest, DISABLED_InEdgeIndexRemovalBenchmark) 
+{
+    // Проверяет: Удаление вершин и поиск источников за O(deg) вместо просмотра всех вершин
+    const int VERTICES = 20000;
+    DirectedGraph<int> graph;
+    for (int v = 1; v < VERTICES; v++) 
+    {
+        graph.AddEdge(v / 2, v);
+        graph.AddEdge((v * 31 + 7) % v, v);
+    }
+    int edges = graph.GetEdgeCount();
+
+    auto start = std::chrono::steady_clock::now();
+    auto sources = TopologicalSort<int>::FindSources(graph);
+    auto sourcesTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    EXPECT_EQ(sources->GetLength(), 1);
+    EXPECT_EQ(sources->Get(0), 0);
+    delete sources;
+
+    start = std::chrono::steady_clock::now();
+    int removedEdges = 0;
+    for (int v = VERTICES - 1; v >= VERTICES / 2; v--) 
+    {
+        removedEdges += graph.InDegree(v) + graph.OutDegree(v);
+        graph.RemoveVertex(v);
+    }
+    auto removeTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "[ BENCH    ] " << VERTICES << " vertices: FindSources " << sourcesTime.count() << " ms, removing half of the vertices " << removeTime.count() << " ms" << std::endl;
+
+    EXPECT_EQ(graph.GetVertexCount(), VERTICES / 2);
+    EXPECT_EQ(graph.GetEdgeCount(), edges - removedEdges);
+}
+
+TEST(GraphTest, GraphBulkEdgeInsertion) 
+{
+    // Проверяет: Построение графа на 100 000 рёбер без копирования словарей смежности
+    const int VERTICES = 1000;
+    const int DEGREE = 100;
+    DirectedGraph<int> directed;
+    UndirectedGraph<int> undirected;
+
+    for (int v = 0; v < VERTICES; v++) 
+    {
+        for (int k = 1; k <= DEGREE; k++) 
+        {
+            directed.AddEdge(v, (v + k) % VERTICES, k);
+        }
+    }
+    for (int v = 0; v < VERTICES; v++) 
+    {
+        for (int k = 1; k <= DEGREE / 2; k++) 
+        {
+            undirected.AddEdge(v, (v + k) % VERTICES, k);
+        }
+    }
+
+    EXPECT_EQ(directed.GetEdgeCount(), VERTICES * DEGREE);
+    EXPECT_EQ(undirected.GetEdgeCount(), VERTICES * DEGREE / 2);
+    EXPECT_EQ(directed.GetEdgeWeight(5, 55), 50.0);
+    EXPECT_EQ(undirected.GetEdgeWeight(55, 5), 50.0);
+
+    directed.SetEdgeWeight(5, 55, 0.5);
+    undirected.SetEdgeWeight(5, 55, 0.5);
+    EXPECT_EQ(directed.GetEdgeWeight(5, 55), 0.5);
+    EXPECT_EQ(undirected.GetEdgeWeight(55, 5), 0.5);
+}
+
+TEST(GraphTest, CsrGraphSnapshot) 
+{
+    // Проверяет: Плотную нумерацию вершин и массивы соседей CSR-снимка
+    DirectedGraph<int> directed;
+    directed.AddEdge(30, 10, 2.5);
+    directed.AddEdge(10, 20, 1.0);
+    directed.AddEdge(10, 30, 4.0);
+    directed.AddVertex(40);
+
+    CsrGraph<int> csr(directed);
+    EXPECT_TRUE(csr.IsDirected());
+    EXPECT_EQ(csr.GetVertexCount(), 4);
+    EXPECT_EQ(csr.GetEdgeCount(), 3);
+    EXPECT_EQ(csr.GetArcCount(), 3);
+    EXPECT_EQ(csr.GetVertex(0), 10);
+    EXPECT_EQ(csr.IndexOf(30), 2);
+    EXPECT_EQ(csr.IndexOf(99), -1);
+
+    auto neighbors = csr.GetNeighbors(csr.IndexOf(10));
+    ASSERT_EQ(neighbors.GetCount(), 2);
+    EXPECT_EQ(csr.GetVertex(neighbors.Target(0)), 20);
+    EXPECT_EQ(neighbors.Weight(1), 4.0);
+    EXPECT_EQ(csr.GetDegree(csr.IndexOf(40)), 0);
+    EXPECT_TRUE(csr.HasArc(2, 0));
+    EXPECT_FALSE(csr.HasArc(0, 3));
+    EXPECT_EQ(csr.GetArcWeight(2, 0), 2.5);
+    EXPECT_THROW(csr.GetArcWeight(1, 0), std::runtime_error);
+    EXPECT_THROW(csr.GetNeighbors(4), std::out_of_range);
+
+    UndirectedGraph<int> undirected;
+    undirected.AddEdge(1, 2);
+    undirected.AddEdge(2, 3);
+    undirected.AddEdge(3, 3);
+    CsrGraph<int> undirectedCsr(undirected);
+    EXPECT_FALSE(undirectedCsr.IsDirected());
+    EXPECT_EQ(undirectedCsr.GetEdgeCount(), 3);
+    EXPECT_EQ(undirectedCsr.GetArcCount(), 5);
+    EXPECT_TRUE(undirectedCsr.HasArc(1, 0));
+}
+
+TEST(GraphTest, CsrTaskOverloadsMatchGraphVersions) 
+{
+    // Проверяет: Перегрузки задач для CSR-снимка дают те же результаты, что и для исходного графа
+    UndirectedGraph<int> undirected;
+    undirected.AddEdge(1, 2, 2.0);
+    undirected.AddEdge(2, 3, 1.0);
+    undirected.AddEdge(1, 3, 5.0);
+    undirected.AddEdge(4, 5, 1.0);
+    undirected.AddVertex(6);
+    CsrGraph<int> undirectedCsr(undirected);
+
+    auto graphDistances = ShortestPath<int>::Dijkstra(undirected, 1);
+    auto csrDistances = ShortestPath<int>::Dijkstra(undirectedCsr, 1);
+    EXPECT_EQ(csrDistances->Get(3), 3.0);
+    EXPECT_EQ(csrDistances->Get(3), graphDistances->Get(3));
+    EXPECT_EQ(csrDistances->Get(5), std::numeric_limits<double>::infinity());
+    delete graphDistances;
+    delete csrDistances;
+
+    auto path = ShortestPath<int>::DijkstraWithPath(undirectedCsr, 1, 3);
+    ASSERT_EQ(path->GetLength(), 3);
+    EXPECT_EQ(path->Get(1), 2);
+    delete path;
+
+    auto bfs = ShortestPath<int>::BFSShortestPath(undirectedCsr, 1);
+    EXPECT_EQ(bfs->Get(3), 1.0);
+    delete bfs;
+
+    EXPECT_EQ(ConnectedComponents<int>::CountComponents(undirectedCsr), 3);
+    EXPECT_FALSE(ConnectedComponents<int>::IsConnected(undirectedCsr));
+    EXPECT_TRUE(ConnectedComponents<int>::AreConnected(undirectedCsr, 5, 4));
+    EXPECT_FALSE(ConnectedComponents<int>::AreConnected(undirectedCsr, 1, 6));
+    auto components = ConnectedComponents<int>::FindComponentsBFS(undirectedCsr);
+    auto graphComponents = ConnectedComponents<int>::FindComponentsBFS(undirected);
+    ASSERT_EQ(components->GetLength(), graphComponents->GetLength());
+    for (int i = 0; i < components->GetLength(); i++) 
+    {
+        ASSERT_EQ(components->Get(i)->GetLength(), graphComponents->Get(i)->GetLength());
+        for (int j = 0; j < components->Get(i)->GetLength(); j++) 
+        {
+            EXPECT_EQ(components->Get(i)->Get(j), graphComponents->Get(i)->Get(j));
+        }
+        delete components->Get(i);
+        delete graphComponents->Get(i);
+    }
+    delete components;
+    delete graphComponents;
+    EXPECT_THROW(TopologicalSort<int>::KahnSort(undirectedCsr), std::runtime_error);
+
+    DirectedGraph<int> order;
+    order.AddEdge(1, 2);
+    order.AddEdge(1, 3);
+    order.AddEdge(2, 4);
+    order.AddEdge(3, 4);
+    order.AddEdge(1, 4);
+    CsrGraph<int> orderCsr(order);
+
+    auto sorted = TopologicalSort<int>::KahnSort(orderCsr);
+    EXPECT_EQ(sorted->Get(0), 1);
+    EXPECT_EQ(sorted->Get(3), 4);
+    delete sorted;
+    auto sources = TopologicalSort<int>::FindSources(orderCsr);
+    ASSERT_EQ(sources->GetLength(), 1);
+    EXPECT_EQ(sources->Get(0), 1);
+    delete sources;
+
+    EXPECT_TRUE(PartialOrder<int>::IsPartialOrder(orderCsr));
+    auto levels = PartialOrder<int>::GetLevels(orderCsr);
+    ASSERT_EQ(levels->GetLength(), 3);
+    EXPECT_EQ(levels->Get(1)->GetLength(), 2);
+    EXPECT_EQ(levels->Get(2)->Get(0), 4);
+    for (int i = 0; i < levels->GetLength(); i++) 
+    {
+        delete levels->Get(i);
+    }
+    delete levels;
+
+    order.AddEdge(4, 1);
+    CsrGraph<int> cyclicCsr(order);
+    EXPECT_FALSE(TopologicalSort<int>::IsAcyclic(cyclicCsr));
+    EXPECT_FALSE(PartialOrder<int>::IsPartialOrder(cyclicCsr));
+}
+
+// Вершина только с operator< (без std::hash): индексы алгоритмов переходят на дерево
+struct OrderedOnlyVertex 
+{
+    int id = 0;
+    bool operator<(const OrderedOnlyVertex& other) const { return id < other.id; }
+    bool operator==(const OrderedOnlyVertex& other) const { return id == other.id; }
+    bool operator!=(const OrderedOnlyVertex& other) const { return id != other.id; }
+};
+
+std::ostream& operator<<(std::ostream& out, const OrderedOnlyVertex& vertex) 
+{
+    return out << vertex.id;
+}
+
+TEST(GraphTest, TasksAcceptVerticesWithoutHash) 
+{
+    // Проверяет: Задачи на CSR-снимке работают с типом вершин, у которого нет std::hash
+    static_assert(!IsHashable<OrderedOnlyVertex>::value, "OrderedOnlyVertex must not be hashable");
+    static_assert(IsHashable<int>::value, "int must be hashable");
+    using V = OrderedOnlyVertex;
+
+    DirectedGraph<V> directed;
+    directed.AddEdge(V{1}, V{2}, 1.0);
+    directed.AddEdge(V{2}, V{3}, 1.0);
+    directed.AddEdge(V{1}, V{3}, 5.0);
+    directed.AddVertex(V{4});
+
+    auto path = ShortestPath<V>::DijkstraWithPath(directed, V{1}, V{3});
+    ASSERT_EQ(path->GetLength(), 3);
+    EXPECT_EQ(path->Get(1).id, 2);
+    delete path;
+
+    auto sorted = TopologicalSort<V>::KahnSort(directed);
+    ASSERT_EQ(sorted->GetLength(), 4);
+    delete sorted;
+    EXPECT_TRUE(PartialOrder<V>::IsPartialOrder(directed));
+    EXPECT_EQ(StronglyConnectedComponents<V>::CountComponents(directed), 4);
+    EXPECT_EQ(AllPairsShortestPaths<V>::Compute(directed).GetDistance(V{1}, V{3}), 2.0);
+
+    UndirectedGraph<V> undirected;
+    undirected.AddEdge(V{1}, V{2}, 1.0);
+    undirected.AddEdge(V{3}, V{4}, 1.0);
+    undirected.AddVertex(V{5});
+    EXPECT_EQ(ConnectedComponents<V>::CountComponents(undirected), 3);
+    EXPECT_TRUE(ConnectedComponents<V>::AreConnected(undirected, V{4}, V{3}));
+    EXPECT_FALSE(ConnectedComponents<V>::AreConnected(undirected, V{1}, V{5}));
+}
+
+TEST(GraphTest, DISABLED_CsrDijkstraBenchmark) 
+{
+    // Проверяет: Повторные запросы Дейкстры к одному CSR-снимку вместо обхода словарей графа
+    const int VERTICES = 20000;
+    const int QUERIES = 20;
+    DirectedGraph<int> graph;
+    for (int v = 0; v < VERTICES; v++) 
+    {
+        graph.AddEdge(v, (v + 1) % VERTICES, 1.0 + v % 7);
+        graph.AddEdge(v, (v * 7 + 3) % VERTICES, 2.0 + v % 5);
+        graph.AddEdge(v, (v * 13 + 11) % VERTICES, 3.0 + v % 3);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    CsrGraph<int> csr(graph);
+    auto buildTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    double checksum = 0.0;
+    for (int q = 0; q < QUERIES; q++) 
+    {
+        auto path = ShortestPath<int>::DijkstraWithPath(csr, q * 97, VERTICES - 1 - q * 31);
+        checksum += path->GetLength();
+        delete path;
+    }
+    auto queryTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "[ BENCH    ] CSR snapshot of " << csr.GetArcCount() << " arcs: build " << buildTime.count() << " ms, " << QUERIES << " Dijkstra queries " << queryTime.count() << " ms" << std::endl;
+
+    EXPECT_EQ(csr.GetArcCount(), graph.GetEdgeCount());
+    EXPECT_GT(checksum, 0.0);
+}
+
+TEST(GraphTest, GraphSerializationDirected) 
+{
+    // Проверяет: Сериализацию и десериализацию ориентированного графа
+    DirectedGraph<int> graph;
+    
+    graph.AddEdge(1, 2, 1.0);
+    graph.AddEdge(1, 3, 2.0);
+    graph.AddEdge(2, 3, 3.0);
+    
+    std::stringstream ss;
+    graph.SerializeToStream(ss);
+    
+    auto deserialized = DirectedGraph<int>::DeserializeFromStream(ss);
+    
+    EXPECT_EQ(deserialized->GetVertexCount(), 3);
+    EXPECT_EQ(deserialized->GetEdgeCount(), 3);
+    EXPECT_TRUE(deserialized->HasEdge(1, 2));
+    EXPECT_TRUE(deserialized->HasEdge(1, 3));
+    EXPECT_TRUE(deserialized->HasEdge(2, 3));
+    EXPECT_EQ(deserialized->GetEdgeWeight(2, 3), 3.0);
+    
+    delete deserialized;
+}
+
+TEST(GraphTest, GraphSerializationUndirected) 
+{
+    // Проверяет: Сериализацию и десериализацию неориентированного графа
+    UndirectedGraph<int> graph;
+    
+    graph.AddEdge(1, 2, 1.0);
+    graph.AddEdge(1, 3, 2.0);
+    graph.AddEdge(2, 3, 3.0);
+    
+    std::stringstream ss;
+    graph.SerializeToStream(ss);
+    
+    auto deserialized = UndirectedGraph<int>::DeserializeFromStream(ss);
+    
+    EXPECT_EQ(deserialized->GetVertexCount(), 3);
+    EXPECT_EQ(deserialized->GetEdgeCount(), 3);
+    EXPECT_TRUE(deserialized->HasEdge(1, 2));
+    EXPECT_TRUE(deserialized->HasEdge(1, 3));
+    EXPECT_TRUE(deserialized->HasEdge(2, 3));
+    EXPECT_EQ(deserialized->GetEdgeWeight(2, 3), 3.0);
+    
+    delete deserialized;
+}
+
+// 7. Тесты для ConnectedComponents
+
+TEST(ConnectedComponentsTest, EmptyGraph) 
+{
     // Проверяет: Компоненты связности пустого графа
     UndirectedGraph<int> graph;
     
@@ -1955,6 +3179,451 @@ TEST(ConnectedComponentsTest, FindLargestAndSmallestComponents)
     delete smallest;
 }
 
+TEST(ConnectedComponentsTest, IncrementalConnectivityMatchesRecomputation) 
+{
+    // Проверяет: Инкрементальная связность после каждой пачки рёбер совпадает с полной разметкой компонент
+    const int VERTICES = 2000;
+    UndirectedGraph<int> graph;
+    for (int v = 0; v < VERTICES; v++) graph.AddVertex(v);
+    IncrementalConnectivity<int> connectivity(graph);
+    EXPECT_EQ(connectivity.CountComponents(), VERTICES);
+
+    unsigned int seed = 53;
+    for (int batch = 0; batch < 10; batch++) 
+    {
+        for (int k = 0; k < 150; k++) 
+        {
+            int from = RandomBelow(seed, VERTICES);
+            int to = RandomBelow(seed, VERTICES);
+            graph.AddEdge(from, to);
+            connectivity.AddEdge(from, to);
+        }
+
+        CsrGraph<int> csr(graph);
+        DynamicArray<int> labels;
+        int count = ConnectedComponents<int>::LabelComponents(csr, labels);
+        ASSERT_EQ(connectivity.CountComponents(), count);
+        DynamicArray<int> sizes(count);
+        for (int i = 0; i < csr.GetVertexCount(); i++) sizes[labels[i]]++;
+        for (int i = 0; i < csr.GetVertexCount(); i += 7) 
+        {
+            int vertex = csr.GetVertex(i);
+            int other = csr.GetVertex((i * 31 + 5) % csr.GetVertexCount());
+            EXPECT_EQ(connectivity.GetComponentSize(vertex), sizes[labels[i]]);
+            EXPECT_EQ(connectivity.AreConnected(vertex, other), labels[i] == labels[csr.IndexOf(other)]);
+        }
+    }
+
+    // Новые вершины появляются вместе с рёбрами
+    EXPECT_TRUE(connectivity.AddEdge(VERTICES, VERTICES + 1));
+    EXPECT_FALSE(connectivity.AddEdge(VERTICES + 1, VERTICES));
+    EXPECT_EQ(connectivity.GetVertexCount(), VERTICES + 2);
+    EXPECT_EQ(connectivity.GetComponentSize(VERTICES), 2);
+    EXPECT_FALSE(connectivity.AreConnected(VERTICES, -1));
+    EXPECT_THROW(connectivity.GetComponentSize(-1), std::runtime_error);
+}
+
+TEST(ConnectedComponentsTest, DISABLED_IncrementalConnectivityBenchmark) 
+{
+    // Проверяет: Время потоковой вставки рёбер с запросами после каждой пачки против пересчёта компонент
+    const int VERTICES = 100000;
+    const int BATCHES = 50;
+    const int BATCH_SIZE = 1000;
+    UndirectedGraph<int> graph;
+    for (int v = 0; v < VERTICES; v++) graph.AddVertex(v);
+    IncrementalConnectivity<int> connectivity(graph);
+
+    unsigned int seed = 59;
+    long long incrementalChecksum = 0;
+    long long recomputedChecksum = 0;
+    std::chrono::microseconds incrementalTime(0);
+    std::chrono::microseconds recomputeTime(0);
+    for (int batch = 0; batch < BATCHES; batch++) 
+    {
+        DynamicArray<std::pair<int, int>> edges;
+        for (int k = 0; k < BATCH_SIZE; k++) 
+        {
+            int from = RandomBelow(seed, VERTICES);
+            edges.PushBack(std::make_pair(from, RandomBelow(seed, VERTICES)));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (int k = 0; k < edges.GetSize(); k++) 
+        {
+            connectivity.AddEdge(edges[k].first, edges[k].second);
+        }
+        incrementalChecksum += connectivity.CountComponents() + connectivity.GetComponentSize(0);
+        incrementalTime += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        for (int k = 0; k < edges.GetSize(); k++) 
+        {
+            graph.AddEdge(edges[k].first, edges[k].second);
+        }
+        start = std::chrono::steady_clock::now();
+        recomputedChecksum += ConnectedComponents<int>::CountComponents(graph) + ConnectedComponents<int>::GetComponentSize(graph, 0);
+        recomputeTime += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    }
+    std::cout << "[ BENCH    ] " << BATCHES << " batches of " << BATCH_SIZE << " edges on " << VERTICES << " vertices: incremental " << incrementalTime.count() / 1000 << " ms, recomputation " << recomputeTime.count() / 1000 << " ms" << std::endl;
+    EXPECT_EQ(incrementalChecksum, recomputedChecksum);
+}
+
+TEST(ConnectedComponentsTest, ParallelLabellingMatchesSequential) 
+{
+    // Проверяет: Параллельная разметка Afforest даёт ту же нумерацию и размеры компонент, что последовательный обход
+    UndirectedGraph<int> graph;
+    const int VERTICES = 5000;
+    unsigned int seed = 61;
+    for (int v = 0; v < VERTICES; v++) graph.AddVertex(v);
+    // Гигантская компонента на первой половине вершин и мелкие цепочки на второй
+    for (int k = 0; k < 6000; k++) 
+    {
+        int from = RandomBelow(seed, VERTICES / 2);
+        graph.AddEdge(from, RandomBelow(seed, VERTICES / 2));
+    }
+    for (int v = VERTICES / 2; v + 1 < VERTICES; v += 3) 
+    {
+        graph.AddEdge(v, v + 1);
+    }
+    CsrGraph<int> csr(graph);
+
+    DynamicArray<int> expected;
+    int expectedCount = ConnectedComponents<int>::LabelComponents(csr, expected);
+    for (int threads : { 1, 3 }) 
+    {
+        ThreadPool pool(threads);
+        DynamicArray<int> labels;
+        DynamicArray<int> sizes;
+        int count = ConnectedComponents<int>::LabelComponentsParallel(csr, labels, sizes, pool);
+        ASSERT_EQ(count, expectedCount);
+        ASSERT_EQ(sizes.GetSize(), count);
+        DynamicArray<int> expectedSizes(count);
+        int mismatches = 0;
+        for (int v = 0; v < csr.GetVertexCount(); v++) 
+        {
+            if (labels[v] != expected[v]) mismatches++;
+            expectedSizes[expected[v]]++;
+        }
+        EXPECT_EQ(mismatches, 0);
+        for (int c = 0; c < count; c++) 
+        {
+            EXPECT_EQ(sizes[c], expectedSizes[c]);
+        }
+    }
+
+    DirectedGraph<int> directed;
+    directed.AddEdge(1, 2);
+    DynamicArray<int> labels;
+    DynamicArray<int> sizes;
+    EXPECT_THROW(ConnectedComponents<int>::LabelComponentsParallel(CsrGraph<int>(directed), labels, sizes), std::runtime_error);
+    EXPECT_EQ(ConnectedComponents<int>::LabelComponentsParallel(CsrGraph<int>(UndirectedGraph<int>()), labels, sizes), 0);
+}
+
+TEST(ConnectedComponentsTest, DISABLED_ParallelLabellingBenchmark) 
+{
+    // Проверяет: Время Afforest на 1, 2, 4 и 8 потоках против BFS и DFS по графу и BFS по снимку
+    const int VERTICES = 200000;
+    const int EDGES = 600000;
+    UndirectedGraph<int> graph;
+    unsigned int seed = 67;
+    for (int v = 0; v < VERTICES; v++) graph.AddVertex(v);
+    for (int k = 0; k < EDGES; k++) 
+    {
+        int from = RandomBelow(seed, VERTICES);
+        graph.AddEdge(from, RandomBelow(seed, VERTICES));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto bfs = ConnectedComponents<int>::FindComponentsBFS(graph);
+    auto bfsTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    start = std::chrono::steady_clock::now();
+    auto dfs = ConnectedComponents<int>::FindComponentsDFS(graph);
+    auto dfsTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    int componentCount = bfs->GetLength();
+    EXPECT_EQ(dfs->GetLength(), componentCount);
+    for (int i = 0; i < bfs->GetLength(); i++) delete bfs->Get(i);
+    for (int i = 0; i < dfs->GetLength(); i++) delete dfs->Get(i);
+    delete bfs;
+    delete dfs;
+
+    CsrGraph<int> csr(graph);
+    DynamicArray<int> expected;
+    start = std::chrono::steady_clock::now();
+    ConnectedComponents<int>::LabelComponents(csr, expected);
+    auto csrTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "[ BENCH    ] " << VERTICES << " vertices, " << EDGES << " edges: BFS " << bfsTime.count() << " ms, DFS " << dfsTime.count() << " ms, CSR BFS " << csrTime.count() << " ms" << std::endl;
+
+    for (int threads : { 1, 2, 4, 8 }) 
+    {
+        ThreadPool pool(threads);
+        DynamicArray<int> labels;
+        DynamicArray<int> sizes;
+        start = std::chrono::steady_clock::now();
+        int count = ConnectedComponents<int>::LabelComponentsParallel(csr, labels, sizes, pool);
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << "[ BENCH    ] Afforest, " << threads << " threads: " << elapsed.count() << " ms" << std::endl;
+        EXPECT_EQ(count, componentCount);
+        int mismatches = 0;
+        for (int v = 0; v < VERTICES; v++) 
+        {
+            if (labels[v] != expected[v]) mismatches++;
+        }
+        EXPECT_EQ(mismatches, 0);
+    }
+}
+
+TEST(StronglyConnectedComponentsTest, ComponentsAndCondensation) 
+{
+    // Проверяет: Компоненты сильной связности, их топологический порядок и конденсация, к которой применимы TopologicalSort и PartialOrder
+    DirectedGraph<int> graph;
+    graph.AddEdge(1, 2, 4.0);
+    graph.AddEdge(2, 3, 1.0);
+    graph.AddEdge(3, 1, 1.0);
+    graph.AddEdge(3, 4, 5.0);
+    graph.AddEdge(1, 4, 2.0);
+    graph.AddEdge(4, 5, 1.0);
+    graph.AddEdge(5, 4, 1.0);
+    graph.AddEdge(5, 6, 3.0);
+    graph.AddEdge(2, 6, 7.0);
+    graph.AddEdge(6, 6, 1.0);
+    graph.AddVertex(7);
+
+    EXPECT_EQ(StronglyConnectedComponents<int>::CountComponents(graph), 4);
+    EXPECT_FALSE(StronglyConnectedComponents<int>::IsStronglyConnected(graph));
+    EXPECT_TRUE(StronglyConnectedComponents<int>::AreStronglyConnected(graph, 3, 2));
+    EXPECT_FALSE(StronglyConnectedComponents<int>::AreStronglyConnected(graph, 3, 4));
+    EXPECT_FALSE(StronglyConnectedComponents<int>::AreStronglyConnected(graph, 3, 42));
+    EXPECT_THROW(TopologicalSort<int>::KahnSort(graph), std::runtime_error);
+
+    CondensationGraph<int> condensation = StronglyConnectedComponents<int>::Condense(graph);
+    ASSERT_EQ(condensation.GetComponentCount(), 4);
+    int cycle = condensation.GetComponent(1);
+    int pair = condensation.GetComponent(4);
+    int loop = condensation.GetComponent(6);
+    int isolated = condensation.GetComponent(7);
+    EXPECT_EQ(condensation.GetComponent(2), cycle);
+    EXPECT_EQ(condensation.GetComponent(5), pair);
+    EXPECT_EQ(condensation.GetComponentSize(cycle), 3);
+    EXPECT_EQ(condensation.GetComponentSize(loop), 1);
+    EXPECT_LT(cycle, pair);
+    EXPECT_LT(pair, loop);
+    EXPECT_EQ(condensation.GetComponentSize(isolated), 1);
+    EXPECT_THROW(condensation.GetComponent(42), std::runtime_error);
+    EXPECT_THROW(condensation.GetComponentSize(4), std::out_of_range);
+
+    Sequence<int>* members = condensation.GetMembers(cycle);
+    ASSERT_EQ(members->GetLength(), 3);
+    EXPECT_EQ(members->Get(0), 1);
+    EXPECT_EQ(members->Get(2), 3);
+    delete members;
+
+    // Параллельные дуги между компонентами сливаются в одну с наименьшим весом, петли отбрасываются
+    const DirectedGraph<int>& dag = condensation.GetGraph();
+    EXPECT_EQ(dag.GetVertexCount(), 4);
+    EXPECT_EQ(dag.GetEdgeCount(), 3);
+    EXPECT_DOUBLE_EQ(dag.GetEdgeWeight(cycle, pair), 2.0);
+    EXPECT_DOUBLE_EQ(dag.GetEdgeWeight(cycle, loop), 7.0);
+    EXPECT_FALSE(dag.HasEdge(loop, loop));
+    // Изолированная вершина - отдельная компонента без дуг, наряду с циклом она минимальна
+    EXPECT_EQ(dag.InDegree(isolated), 0);
+    EXPECT_EQ(dag.OutDegree(isolated), 0);
+    EXPECT_TRUE(TopologicalSort<int>::IsAcyclic(dag));
+    EXPECT_TRUE(PartialOrder<int>::IsPartialOrder(dag));
+    Sequence<int>* minimal = PartialOrder<int>::FindMinimalElements(dag);
+    EXPECT_EQ(minimal->GetLength(), 2);
+    delete minimal;
+    Sequence<int>* sorted = TopologicalSort<int>::KahnSort(dag);
+    EXPECT_EQ(sorted->GetLength(), 4);
+    delete sorted;
+
+    Sequence<Sequence<int>*>* components = StronglyConnectedComponents<int>::FindComponents(graph);
+    ASSERT_EQ(components->GetLength(), 4);
+    EXPECT_EQ(components->Get(cycle)->GetLength(), 3);
+    EXPECT_EQ(components->Get(pair)->Get(0), 4);
+    for (int i = 0; i < components->GetLength(); i++) delete components->Get(i);
+    delete components;
+
+    DirectedGraph<int> empty;
+    EXPECT_EQ(StronglyConnectedComponents<int>::CountComponents(empty), 0);
+    EXPECT_EQ(StronglyConnectedComponents<int>::Condense(empty).GetComponentCount(), 0);
+}
+
+TEST(StronglyConnectedComponentsTest, MatchesMutualReachability) 
+{
+    // Проверяет: Тарьян и forward-backward дают разбиение по взаимной достижимости, номера Тарьяна топологически упорядочены
+    const int VERTICES = 400;
+    DirectedGraph<int> graph;
+    BuildRandomGraph(graph, VERTICES, 520, 71);
+    CsrGraph<int> csr(graph);
+
+    std::vector<std::vector<char>> reach(VERTICES, std::vector<char>(VERTICES, 0));
+    for (int s = 0; s < VERTICES; s++) 
+    {
+        std::vector<int> queue(1, s);
+        reach[s][s] = 1;
+        for (size_t head = 0; head < queue.size(); head++) 
+        {
+            for (int w : csr.GetNeighbors(queue[head])) 
+            {
+                if (!reach[s][w]) 
+                {
+                    reach[s][w] = 1;
+                    queue.push_back(w);
+                }
+            }
+        }
+    }
+
+    DynamicArray<int> labels;
+    int count = StronglyConnectedComponents<int>::LabelComponents(csr, labels);
+    EXPECT_GT(count, 1);
+    EXPECT_LT(count, VERTICES);
+    int wrong = 0;
+    for (int u = 0; u < VERTICES; u++) 
+    {
+        for (int v = 0; v < VERTICES; v++) 
+        {
+            bool together = reach[u][v] && reach[v][u];
+            if (together != (labels[u] == labels[v])) wrong++;
+        }
+        for (int v : csr.GetNeighbors(u)) 
+        {
+            if (labels[u] > labels[v]) wrong++;
+        }
+    }
+    EXPECT_EQ(wrong, 0);
+
+    // Параллельная разметка нумерует компоненты по наименьшей вершине: сравниваем разбиения
+    for (int threads : { 1, 3 }) 
+    {
+        ThreadPool pool(threads);
+        DynamicArray<int> parallel;
+        ASSERT_EQ(StronglyConnectedComponents<int>::LabelComponentsParallel(csr, parallel, pool), count);
+        int mismatches = 0;
+        for (int u = 0; u < VERTICES; u++) 
+        {
+            for (int v = u + 1; v < VERTICES; v++) 
+            {
+                if ((labels[u] == labels[v]) != (parallel[u] == parallel[v])) mismatches++;
+            }
+        }
+        EXPECT_EQ(mismatches, 0);
+    }
+}
+
+TEST(StronglyConnectedComponentsTest, LargeGraphsWithoutRecursion) 
+{
+    // Проверяет: Цикл из миллиона вершин без рекурсии, цепочку 2-циклов и совпадение параллельной конденсации с последовательной
+    const int CYCLE = 1000000;
+    DirectedGraph<int> ring;
+    for (int v = 0; v < CYCLE; v++) 
+    {
+        ring.AddEdge(v, (v + 1) % CYCLE);
+    }
+    ring.AddEdge(CYCLE, 0);
+    CsrGraph<int> ringCsr(ring);
+    DynamicArray<int> ringLabels;
+    EXPECT_EQ(StronglyConnectedComponents<int>::LabelComponents(ringCsr, ringLabels), 2);
+    EXPECT_EQ(StronglyConnectedComponents<int>::LabelComponentsParallel(ringCsr, ringLabels), 2);
+
+    // Цепочка 2-циклов a <-> b -> a' <-> b' -> ...: отсечение её не уменьшает, а неудачная опорная
+    // вершина отделяла бы по одной паре за проход по всей цепочке
+    const int PAIRS = 100000;
+    DirectedGraph<int> chain;
+    for (int p = 0; p < PAIRS; p++) 
+    {
+        chain.AddEdge(2 * p, 2 * p + 1);
+        chain.AddEdge(2 * p + 1, 2 * p);
+        if (p + 1 < PAIRS) chain.AddEdge(2 * p + 1, 2 * p + 2);
+    }
+    CsrGraph<int> chainCsr(chain);
+    DynamicArray<int> chainLabels;
+    ASSERT_EQ(StronglyConnectedComponents<int>::LabelComponentsParallel(chainCsr, chainLabels), PAIRS);
+    int unpaired = 0;
+    for (int p = 0; p < PAIRS; p++) 
+    {
+        if (chainLabels[chainCsr.IndexOf(2 * p)] != chainLabels[chainCsr.IndexOf(2 * p + 1)]) unpaired++;
+    }
+    EXPECT_EQ(unpaired, 0);
+
+    // Гигантская компонента на первой половине вершин, ацикличный хвост - на второй
+    const int VERTICES = 20000;
+    const int EDGES = 100000;
+    DirectedGraph<int> graph;
+    unsigned int seed = 73;
+    for (int v = 0; v < VERTICES; v++) graph.AddVertex(v);
+    for (int k = 0; k < EDGES; k++) 
+    {
+        int u = RandomBelow(seed, VERTICES);
+        int v = RandomBelow(seed, VERTICES);
+        if (u >= VERTICES / 2 && v < u) std::swap(u, v);
+        graph.AddEdge(u, v);
+    }
+    CsrGraph<int> csr(graph);
+    DynamicArray<int> labels;
+    int count = StronglyConnectedComponents<int>::LabelComponents(csr, labels);
+    CondensationGraph<int> expected = StronglyConnectedComponents<int>::Condense(csr);
+
+    for (int threads : { 1, 3 }) 
+    {
+        ThreadPool pool(threads);
+        DynamicArray<int> parallel;
+        EXPECT_EQ(StronglyConnectedComponents<int>::LabelComponentsParallel(csr, parallel, pool), count);
+        CondensationGraph<int> condensation = StronglyConnectedComponents<int>::Condense(csr, pool);
+        int mismatches = 0;
+        for (int v = 0; v < VERTICES; v++) 
+        {
+            if (condensation.GetComponent(v) != expected.GetComponent(v)) mismatches++;
+        }
+        EXPECT_EQ(mismatches, 0);
+        EXPECT_EQ(condensation.GetGraph().GetEdgeCount(), expected.GetGraph().GetEdgeCount());
+    }
+}
+
+TEST(StronglyConnectedComponentsTest, DISABLED_ForwardBackwardBenchmark) 
+{
+    // Проверяет: Время Тарьяна против forward-backward на 1, 2, 4 и 8 потоках
+    // Гигантская компонента на первой половине вершин, ацикличный хвост - на второй
+    const int VERTICES = 200000;
+    const int EDGES = 600000;
+    DirectedGraph<int> graph;
+    unsigned int seed = 73;
+    for (int v = 0; v < VERTICES; v++) graph.AddVertex(v);
+    for (int k = 0; k < EDGES; k++) 
+    {
+        int u = RandomBelow(seed, VERTICES);
+        int v = RandomBelow(seed, VERTICES);
+        if (u >= VERTICES / 2 && v < u) std::swap(u, v);
+        graph.AddEdge(u, v);
+    }
+    CsrGraph<int> csr(graph);
+
+    DynamicArray<int> labels;
+    auto start = std::chrono::steady_clock::now();
+    int count = StronglyConnectedComponents<int>::LabelComponents(csr, labels);
+    auto tarjanTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "[ BENCH    ] " << VERTICES << " vertices, " << EDGES << " arcs, " << count << " components: Tarjan " << tarjanTime.count() << " ms" << std::endl;
+    CondensationGraph<int> expected = StronglyConnectedComponents<int>::Condense(csr);
+
+    for (int threads : { 1, 2, 4, 8 }) 
+    {
+        ThreadPool pool(threads);
+        DynamicArray<int> parallel;
+        start = std::chrono::steady_clock::now();
+        EXPECT_EQ(StronglyConnectedComponents<int>::LabelComponentsParallel(csr, parallel, pool), count);
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << "[ BENCH    ] Forward-backward, " << threads << " threads: " << elapsed.count() << " ms" << std::endl;
+
+        CondensationGraph<int> condensation = StronglyConnectedComponents<int>::Condense(csr, pool);
+        int mismatches = 0;
+        for (int v = 0; v < VERTICES; v++) 
+        {
+            if (condensation.GetComponent(v) != expected.GetComponent(v)) mismatches++;
+        }
+        EXPECT_EQ(mismatches, 0);
+        EXPECT_EQ(condensation.GetGraph().GetEdgeCount(), expected.GetGraph().GetEdgeCount());
+    }
+}
+
 // 8. Тесты для TopologicalSort
 
 TEST(TopologicalSortTest, EmptyGraph) 
@@ -2005,172 +3674,1550 @@ TEST(TopologicalSortTest, SimpleDAG)
         for (int j = 0; j < adj->GetLength(); j++) {
             EXPECT_TRUE(visited.find(adj->Get(j)) == visited.end());
         }
-        delete adj;
+        delete adj;
+    }
+    delete sortedKahn;
+}
+
+TEST(TopologicalSortTest, GraphWithCycle) 
+{
+    // Проверяет: Обработку графа с циклом при топологической сортировке
+    DirectedGraph<int> graph;
+    
+    graph.AddEdge(1, 2);
+    graph.AddEdge(2, 3);
+    graph.AddEdge(3, 1);
+    
+    EXPECT_FALSE(TopologicalSort<int>::IsAcyclic(graph));
+    
+    EXPECT_THROW(TopologicalSort<int>::KahnSort(graph), std::runtime_error);
+    EXPECT_THROW(TopologicalSort<int>::DFSSort(graph), std::runtime_error);
+}
+
+TEST(TopologicalSortTest, ComplexDAG) 
+{
+    // Проверяет: Топологическую сортировку сложного ациклического графа
+    DirectedGraph<std::string> graph;
+    
+    graph.AddEdge("A", "B");
+    graph.AddEdge("A", "C");
+    graph.AddEdge("B", "D");
+    graph.AddEdge("C", "D");
+    graph.AddEdge("D", "E");
+    graph.AddEdge("D", "F");
+    
+    auto sorted = TopologicalSort<std::string>::KahnSort(graph);
+    EXPECT_EQ(sorted->GetLength(), 6);
+    
+    bool foundA = false, foundE = false;
+    for (int i = 0; i < sorted->GetLength(); i++) {
+        if (sorted->Get(i) == "A") foundA = true;
+        if (sorted->Get(i) == "E") foundE = true;
+    }
+    EXPECT_TRUE(foundA);
+    EXPECT_TRUE(foundE);
+    
+    delete sorted;
+}
+
+TEST(TopologicalSortTest, DeepGraphsWithoutRecursion) 
+{
+    // Проверяет: DFS-сортировка и DFS-компоненты на пути из миллиона вершин не упираются в стек вызовов
+    const int VERTICES = 1000000;
+    DirectedGraph<int> path;
+    for (int v = 0; v + 1 < VERTICES; v++) 
+    {
+        path.AddEdge(v, v + 1);
+    }
+    Sequence<int>* sorted = TopologicalSort<int>::DFSSort(path);
+    ASSERT_EQ(sorted->GetLength(), VERTICES);
+    int misplaced = 0;
+    for (int i = 0; i < VERTICES; i++) 
+    {
+        if (sorted->Get(i) != i) misplaced++;
+    }
+    EXPECT_EQ(misplaced, 0);
+    delete sorted;
+
+    // Замыкающая дуга делает граф циклом длины VERTICES
+    path.AddEdge(VERTICES - 1, 0);
+    EXPECT_THROW(TopologicalSort<int>::DFSSort(path), std::runtime_error);
+
+    UndirectedGraph<int> line;
+    for (int v = 0; v + 1 < VERTICES; v++) 
+    {
+        line.AddEdge(v, v + 1);
+    }
+    line.AddVertex(VERTICES);
+    Sequence<Sequence<int>*>* components = ConnectedComponents<int>::FindComponentsDFS(line);
+    ASSERT_EQ(components->GetLength(), 2);
+    EXPECT_EQ(components->Get(0)->GetLength(), VERTICES);
+    EXPECT_EQ(components->Get(0)->Get(VERTICES - 1), VERTICES - 1);
+    EXPECT_EQ(components->Get(1)->GetLength(), 1);
+    for (int i = 0; i < components->GetLength(); i++) delete components->Get(i);
+    delete components;
+}
+
+TEST(TopologicalSortTest, WavefrontLevels) 
+{
+    // Проверяет: Волновой алгоритм Кана даёт топологический порядок, уровни по самому длинному пути и одинаковый результат на любом числе потоков
+    const int VERTICES = 3000;
+    DirectedGraph<int> graph;
+    unsigned int seed = 79;
+    for (int v = 0; v < VERTICES; v++) graph.AddVertex(v);
+    for (int k = 0; k < 9000; k++) 
+    {
+        int u = RandomBelow(seed, VERTICES);
+        int v = RandomBelow(seed, VERTICES);
+        if (u == v) continue;
+        graph.AddEdge(std::min(u, v), std::max(u, v));
+    }
+    CsrGraph<int> csr(graph);
+
+    // Самый длинный путь в вершину: вершины уже пронумерованы топологически
+    std::vector<int> expectedLevel(VERTICES, 0);
+    for (int u = 0; u < VERTICES; u++) 
+    {
+        for (int v : csr.GetNeighbors(u)) 
+        {
+            expectedLevel[v] = std::max(expectedLevel[v], expectedLevel[u] + 1);
+        }
+    }
+
+    DynamicArray<int> reference;
+    for (int threads : { 1, 3 }) 
+    {
+        ThreadPool pool(threads);
+        DynamicArray<int> order;
+        DynamicArray<int> levels;
+        ASSERT_EQ(TopologicalSort<int>::KahnLevels(csr, order, levels, pool), VERTICES);
+        std::vector<int> position(VERTICES, -1);
+        for (int i = 0; i < VERTICES; i++) position[order[i]] = i;
+        int wrong = 0;
+        for (int u = 0; u < VERTICES; u++) 
+        {
+            if (position[u] == -1 || levels[u] != expectedLevel[u]) wrong++;
+            for (int v : csr.GetNeighbors(u)) 
+            {
+                if (position[u] >= position[v]) wrong++;
+            }
+        }
+        EXPECT_EQ(wrong, 0);
+        if (threads == 1) 
+        {
+            reference = order;
+            continue;
+        }
+        int mismatches = 0;
+        for (int i = 0; i < VERTICES; i++) 
+        {
+            if (order[i] != reference[i]) mismatches++;
+        }
+        EXPECT_EQ(mismatches, 0);
+    }
+
+    DirectedGraph<int> diamond;
+    diamond.AddEdge(1, 2);
+    diamond.AddEdge(1, 3);
+    diamond.AddEdge(2, 4);
+    diamond.AddEdge(3, 4);
+    diamond.AddEdge(1, 4);
+    Sequence<Sequence<int>*>* waves = TopologicalSort<int>::LevelSort(diamond);
+    ASSERT_EQ(waves->GetLength(), 3);
+    EXPECT_EQ(waves->Get(0)->GetLength(), 1);
+    EXPECT_EQ(waves->Get(1)->GetLength(), 2);
+    EXPECT_EQ(waves->Get(2)->Get(0), 4);
+    for (int i = 0; i < waves->GetLength(); i++) delete waves->Get(i);
+    delete waves;
+
+    // Вершины на цикле и за ним не упорядочиваются и получают уровень -1
+    diamond.AddEdge(4, 5);
+    diamond.AddEdge(5, 4);
+    diamond.AddEdge(5, 6);
+    CsrGraph<int> cyclic(diamond);
+    DynamicArray<int> order;
+    DynamicArray<int> levels;
+    EXPECT_EQ(TopologicalSort<int>::KahnLevels(cyclic, order, levels), 3);
+    EXPECT_EQ(levels[cyclic.IndexOf(6)], -1);
+    EXPECT_FALSE(TopologicalSort<int>::IsAcyclic(cyclic));
+    EXPECT_THROW(TopologicalSort<int>::LevelSort(diamond), std::runtime_error);
+    EXPECT_TRUE(TopologicalSort<int>::IsAcyclic(csr));
+
+    DirectedGraph<int> ring;
+    ring.AddEdge(1, 2);
+    ring.AddEdge(2, 1);
+    EXPECT_FALSE(TopologicalSort<int>::IsAcyclic(ring));
+    DirectedGraph<int> isolated;
+    isolated.AddVertex(1);
+    EXPECT_TRUE(TopologicalSort<int>::IsAcyclic(isolated));
+    Sequence<Sequence<int>*>* none = TopologicalSort<int>::LevelSort(DirectedGraph<int>());
+    EXPECT_EQ(none->GetLength(), 0);
+    delete none;
+}
+
+TEST(TopologicalSortTest, DISABLED_WavefrontBenchmark) 
+{
+    // Проверяет: Время последовательного алгоритма Кана и волнового на 1, 2, 4 и 8 потоках на широком DAG
+    const int VERTICES = 200000;
+    const int EDGES = 600000;
+    DirectedGraph<int> graph;
+    unsigned int seed = 83;
+    for (int v = 0; v < VERTICES; v++) graph.AddVertex(v);
+    for (int k = 0; k < EDGES; k++) 
+    {
+        int u = RandomBelow(seed, VERTICES);
+        int v = RandomBelow(seed, VERTICES);
+        if (u == v) continue;
+        graph.AddEdge(std::min(u, v), std::max(u, v));
+    }
+    CsrGraph<int> csr(graph);
+
+    DynamicArray<int> sequential;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(TopologicalSort<int>::KahnOrder(csr, sequential), VERTICES);
+    auto kahnTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(TopologicalSort<int>::IsAcyclic(csr));
+    auto acyclicTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "[ BENCH    ] " << VERTICES << " vertices, " << csr.GetArcCount() << " arcs: KahnOrder " << kahnTime.count() << " ms, IsAcyclic " << acyclicTime.count() << " ms" << std::endl;
+
+    for (int threads : { 1, 2, 4, 8 }) 
+    {
+        ThreadPool pool(threads);
+        DynamicArray<int> order;
+        DynamicArray<int> levels;
+        start = std::chrono::steady_clock::now();
+        EXPECT_EQ(TopologicalSort<int>::KahnLevels(csr, order, levels, pool), VERTICES);
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        int depth = 0;
+        for (int v = 0; v < VERTICES; v++) depth = std::max(depth, levels[v] + 1);
+        std::cout << "[ BENCH    ] Wavefront Kahn, " << threads << " threads: " << elapsed.count() << " ms, " << depth << " levels" << std::endl;
+    }
+}
+
+// 9. Тесты для ShortestPath
+
+TEST(ShortestPathTest, SingleVertexGraph) 
+{
+    // Проверяет: Кратчайшие пути в графе с одной вершиной
+    DirectedGraph<int> graph;
+    graph.AddVertex(1);
+    
+    auto distances = ShortestPath<int>::Dijkstra(graph, 1);
+    EXPECT_EQ(distances->GetCount(), 1);
+    EXPECT_EQ(distances->Get(1), 0.0);
+    
+    auto path = ShortestPath<int>::FindShortestPath(graph, 1, 1);
+    EXPECT_EQ(path->GetLength(), 1);
+    EXPECT_EQ(path->Get(0), 1);
+    
+    delete distances;
+    delete path;
+}
+
+TEST(ShortestPathTest, SimpleWeightedGraph) 
+{
+    // Проверяет: Кратчайшие пути во взвешенном графе
+    DirectedGraph<std::string> graph;
+    
+    graph.AddEdge("A", "B", 1.0);
+    graph.AddEdge("A", "C", 4.0);
+    graph.AddEdge("B", "C", 2.0);
+    graph.AddEdge("B", "D", 5.0);
+    graph.AddEdge("C", "D", 1.0);
+    
+    auto distances = ShortestPath<std::string>::Dijkstra(graph, "A");
+    
+    EXPECT_EQ(distances->Get("A"), 0.0);
+    EXPECT_EQ(distances->Get("B"), 1.0);
+    EXPECT_EQ(distances->Get("C"), 3.0);
+    EXPECT_EQ(distances->Get("D"), 4.0);
+    
+    auto path = ShortestPath<std::string>::FindShortestPath(graph, "A", "D");
+    EXPECT_EQ(path->GetLength(), 4);
+    EXPECT_EQ(path->Get(0), "A");
+    EXPECT_EQ(path->Get(1), "B");
+    EXPECT_EQ(path->Get(2), "C");
+    EXPECT_EQ(path->Get(3), "D");
+    
+    delete distances;
+    delete path;
+}
+
+TEST(ShortestPathTest, BFSUnweightedGraph) 
+{
+    // Проверяет: Кратчайшие пути в невзвешенном графе с помощью BFS
+    UndirectedGraph<int> graph;
+    
+    graph.AddEdge(1, 2);
+    graph.AddEdge(1, 3);
+    graph.AddEdge(2, 4);
+    graph.AddEdge(3, 4);
+    graph.AddEdge(4, 5);
+    
+    auto distances = ShortestPath<int>::BFSShortestPath(graph, 1);
+    
+    EXPECT_EQ(distances->Get(1), 0.0);
+    EXPECT_EQ(distances->Get(2), 1.0);
+    EXPECT_EQ(distances->Get(3), 1.0);
+    EXPECT_EQ(distances->Get(4), 2.0);
+    EXPECT_EQ(distances->Get(5), 3.0);
+    
+    delete distances;
+}
+
+TEST(ShortestPathTest, DISABLED_BFSPathGraphBenchmark) 
+{
+    // Проверяет: BFS на пути из 10^6 вершин работает за линейное время
+    const int VERTICES = 1000000;
+    UndirectedGraph<int> graph;
+    for (int v = 1; v < VERTICES; v++) 
+    {
+        graph.AddEdge(v - 1, v);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto distances = ShortestPath<int>::BFSShortestPath(graph, 0);
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "[ BENCH    ] BFS on path of " << VERTICES << " vertices: " << elapsed.count() << " ms" << std::endl;
+
+    EXPECT_EQ(distances->GetCount(), VERTICES);
+    EXPECT_EQ(distances->Get(VERTICES - 1), VERTICES - 1.0);
+    EXPECT_EQ(distances->Get(VERTICES / 2), VERTICES / 2.0);
+    delete distances;
+}
+
+TEST(ShortestPathTest, BellmanFordNegativeWeights) 
+{
+    // Проверяет: Алгоритм Беллмана-Форда для графов с отрицательными весами
+    DirectedGraph<int> graph;
+    
+    graph.AddEdge(1, 2, 6.0);
+    graph.AddEdge(1, 3, 5.0);
+    graph.AddEdge(1, 4, 5.0);
+    graph.AddEdge(2, 5, -1.0);
+    graph.AddEdge(3, 2, -2.0);
+    graph.AddEdge(3, 5, 1.0);
+    graph.AddEdge(4, 3, -2.0);
+    graph.AddEdge(4, 6, -1.0);
+    graph.AddEdge(5, 7, 3.0);
+    graph.AddEdge(6, 7, 3.0);
+    
+    auto distances = ShortestPath<int>::BellmanFord(graph, 1);
+    
+    EXPECT_EQ(distances->Get(1), 0.0);
+    EXPECT_EQ(distances->Get(2), 1.0);
+    EXPECT_EQ(distances->Get(3), 3.0);
+    EXPECT_EQ(distances->Get(4), 5.0);
+    EXPECT_EQ(distances->Get(5), 0.0);
+    EXPECT_EQ(distances->Get(6), 4.0);
+    EXPECT_EQ(distances->Get(7), 3.0);
+    
+    delete distances;
+}
+
+TEST(ShortestPathTest, BellmanFordModesAndNegativeCycle) 
+{
+    // Проверяет: Раунды, очередь SPFA и параллельные раунды дают одни расстояния, отрицательный цикл возвращается списком вершин
+    DirectedGraph<int> graph;
+    const int VERTICES = 500;
+    unsigned int seed = 3;
+    for (int v = 0; v < VERTICES; v++) 
+    {
+        for (int k = 0; k < 3; k++) 
+        {
+            // Вес с потенциалом: w + p(from) - p(to) при w >= 0 даёт отрицательные дуги без отрицательных циклов
+            int to = RandomBelow(seed, VERTICES);
+            graph.AddEdge(v, to, 1.0 + RandomBelow(seed, 10) + (v % 17) - (to % 17));
+        }
+    }
+    CsrGraph<int> csr(graph);
+    ThreadPool pool(3);
+    auto queue = ShortestPath<int>::RunBellmanFord(csr, 0, BellmanFordMode::Queue);
+    auto rounds = ShortestPath<int>::RunBellmanFord(csr, 0, BellmanFordMode::Rounds);
+    auto parallel = ShortestPath<int>::RunBellmanFord(csr, 0, BellmanFordMode::ParallelRounds, pool);
+    EXPECT_FALSE(queue.HasNegativeCycle());
+    EXPECT_FALSE(rounds.HasNegativeCycle());
+    EXPECT_FALSE(parallel.HasNegativeCycle());
+    for (int v = 0; v < csr.GetVertexCount(); v++) 
+    {
+        EXPECT_EQ(queue.GetDistance(v), rounds.GetDistance(v));
+        EXPECT_EQ(parallel.GetDistance(v), rounds.GetDistance(v));
+    }
+
+    // Цикл 20 -> 21 -> 22 -> 20 весом -1, достижимый из 0 через 10
+    DirectedGraph<int> cyclic;
+    cyclic.AddEdge(0, 10, 1.0);
+    cyclic.AddEdge(10, 20, 1.0);
+    cyclic.AddEdge(20, 21, 2.0);
+    cyclic.AddEdge(21, 22, -4.0);
+    cyclic.AddEdge(22, 20, 1.0);
+    cyclic.AddEdge(22, 30, 1.0);
+    cyclic.AddEdge(40, 41, -5.0);
+    cyclic.AddEdge(41, 40, 1.0);
+    CsrGraph<int> cyclicCsr(cyclic);
+    for (BellmanFordMode mode : { BellmanFordMode::Queue, BellmanFordMode::Rounds, BellmanFordMode::ParallelRounds }) 
+    {
+        auto result = ShortestPath<int>::RunBellmanFord(cyclicCsr, cyclicCsr.IndexOf(0), mode, pool);
+        ASSERT_TRUE(result.HasNegativeCycle());
+        const DynamicArray<int>& cycle = result.GetNegativeCycle();
+        ASSERT_EQ(cycle.GetSize(), 3);
+        double weight = 0.0;
+        for (int i = 0; i < cycle.GetSize(); i++) 
+        {
+            int from = cycle[i];
+            int to = cycle[(i + 1) % cycle.GetSize()];
+            ASSERT_TRUE(cyclic.HasEdge(from, to));
+            weight += cyclic.GetEdgeWeight(from, to);
+            EXPECT_GE(from, 20);
+            EXPECT_LE(from, 22);
+        }
+        EXPECT_EQ(weight, -1.0);
+    }
+
+    // Цикл 40 <-> 41 недостижим из 0 и не мешает
+    cyclic.RemoveEdge(21, 22);
+    auto none = ShortestPath<int>::FindNegativeCycle(cyclic, 0);
+    EXPECT_EQ(none->GetLength(), 0);
+    delete none;
+    auto found = ShortestPath<int>::FindNegativeCycle(cyclic, 40);
+    EXPECT_EQ(found->GetLength(), 2);
+    delete found;
+    EXPECT_THROW(ShortestPath<int>::BellmanFord(cyclic, 41), std::runtime_error);
+}
+
+TEST(ShortestPathTest, DISABLED_BellmanFordModesBenchmark) 
+{
+    // Проверяет: Время и число релаксаций Беллмана-Форда в трёх режимах на графе с отрицательными дугами
+    const int VERTICES = 20000;
+    DirectedGraph<int> graph;
+    unsigned int seed = 19;
+    for (int v = 0; v < VERTICES; v++) 
+    {
+        for (int k = 0; k < 4; k++) 
+        {
+            int to = RandomBelow(seed, VERTICES);
+            graph.AddEdge(v, to, 1.0 + RandomBelow(seed, 20) + (v % 31) - (to % 31));
+        }
+    }
+    CsrGraph<int> csr(graph);
+
+    const char* names[] = { "rounds", "queue", "parallel rounds" };
+    BellmanFordMode modes[] = { BellmanFordMode::Rounds, BellmanFordMode::Queue, BellmanFordMode::ParallelRounds };
+    DynamicArray<double> reference;
+    for (int m = 0; m < 3; m++) 
+    {
+        auto start = std::chrono::steady_clock::now();
+        auto result = ShortestPath<int>::RunBellmanFord(csr, 0, modes[m]);
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << "[ BENCH    ] Bellman-Ford " << names[m] << " on " << VERTICES << " vertices: " << elapsed.count() << " ms, " << result.GetRelaxationCount() << " relaxations" << std::endl;
+        EXPECT_FALSE(result.HasNegativeCycle());
+        if (m == 0) 
+        {
+            reference = DynamicArray<double>(VERTICES);
+            for (int v = 0; v < VERTICES; v++) reference[v] = result.GetDistance(v);
+            continue;
+        }
+        int mismatches = 0;
+        for (int v = 0; v < VERTICES; v++) 
+        {
+            if (result.GetDistance(v) != reference[v]) mismatches++;
+        }
+        EXPECT_EQ(mismatches, 0);
+    }
+}
+
+TEST(ShortestPathTest, GraphDiameterAndRadius) 
+{
+    // Проверяет: Диаметр и радиус графа
+    UndirectedGraph<int> graph;
+    
+    graph.AddEdge(1, 2);
+    graph.AddEdge(2, 3);
+    graph.AddEdge(3, 4);
+    graph.AddEdge(4, 5);
+    
+    double diameter = ShortestPath<int>::GetGraphDiameter(graph);
+    double radius = ShortestPath<int>::GetGraphRadius(graph);
+    
+    EXPECT_GT(diameter, 0.0);
+    EXPECT_GT(radius, 0.0);
+    EXPECT_GE(diameter, radius);
+    
+    auto center = ShortestPath<int>::FindGraphCenter(graph);
+    EXPECT_GT(center->GetLength(), 0);
+    delete center;
+}
+
+TEST(ShortestPathTest, DijkstraMatchesBellmanFordOnRandomGraph) 
+{
+    // Проверяет: Дейкстру на индексированной куче против Беллмана-Форда
+    DirectedGraph<int> graph;
+
+    const int VERTICES = 300;
+    BuildRandomGraph(graph, VERTICES, VERTICES * 5, 12345, 20);
+
+    auto dijkstra = ShortestPath<int>::Dijkstra(graph, 0);
+    auto bellmanFord = ShortestPath<int>::BellmanFord(graph, 0);
+    for (int i = 0; i < VERTICES; i++) 
+    {
+        EXPECT_EQ(dijkstra->Get(i), bellmanFord->Get(i));
+    }
+
+    for (int target = 0; target < VERTICES; target += 37) 
+    {
+        auto path = ShortestPath<int>::DijkstraWithPath(graph, 0, target);
+        if (dijkstra->Get(target) == std::numeric_limits<double>::infinity()) 
+        {
+            EXPECT_EQ(path->GetLength(), 0);
+        }
+        else 
+        {
+            double length = 0.0;
+            for (int i = 0; i + 1 < path->GetLength(); i++) 
+            {
+                length += graph.GetEdgeWeight(path->Get(i), path->Get(i + 1));
+            }
+            EXPECT_EQ(path->GetFirst(), 0);
+            EXPECT_EQ(path->GetLast(), target);
+            EXPECT_EQ(length, dijkstra->Get(target));
+        }
+        delete path;
+    }
+
+    delete dijkstra;
+    delete bellmanFord;
+}
+
+TEST(ShortestPathTest, DijkstraWorkspaceReuse) 
+{
+    // Проверяет: Повторные запросы с одной рабочей памятью и раннюю остановку на цели
+    const int SIDE = 40;
+    UndirectedGraph<int> grid;
+    for (int r = 0; r < SIDE; r++) 
+    {
+        for (int c = 0; c < SIDE; c++) 
+        {
+            int v = r * SIDE + c;
+            if (c + 1 < SIDE) grid.AddEdge(v, v + 1, 1.0 + (v % 3));
+            if (r + 1 < SIDE) grid.AddEdge(v, v + SIDE, 1.0 + (v % 5));
+        }
+    }
+    CsrGraph<int> csr(grid);
+    DijkstraWorkspace workspace;
+
+    for (int q = 0; q < 10; q++) 
+    {
+        int source = (q * 131) % (SIDE * SIDE);
+        int target = (q * 377 + 50) % (SIDE * SIDE);
+        auto full = ShortestPath<int>::Dijkstra(csr, source);
+        double distance = ShortestPath<int>::ShortestDistance(csr, source, target, workspace);
+        EXPECT_EQ(distance, full->Get(target));
+        EXPECT_LE(workspace.GetSettledCount(), SIDE * SIDE);
+
+        auto path = ShortestPath<int>::DijkstraWithPath(csr, source, target, workspace);
+        double length = 0.0;
+        for (int i = 0; i + 1 < path->GetLength(); i++) 
+        {
+            length += grid.GetEdgeWeight(path->Get(i), path->Get(i + 1));
+        }
+        EXPECT_EQ(length, distance);
+        delete path;
+        delete full;
+    }
+
+    // Соседняя вершина находится почти сразу, остальная часть графа не обходится
+    ShortestPath<int>::ShortestDistance(csr, 0, 1, workspace);
+    EXPECT_LT(workspace.GetSettledCount(), 10);
+    EXPECT_LT(workspace.GetReachedCount(), 20);
+    EXPECT_EQ(workspace.GetDistance(csr.IndexOf(SIDE * SIDE - 1)), std::numeric_limits<double>::infinity());
+
+    EXPECT_THROW(ShortestPath<int>::ShortestDistance(csr, 0, -5, workspace), std::runtime_error);
+    EXPECT_THROW(ShortestPath<int>::RunDijkstra(csr, SIDE * SIDE, -1, workspace), std::out_of_range);
+}
+
+TEST(ShortestPathTest, ShortestPathTreeAnswersPathQueries) 
+{
+    // Проверяет: Деревья Дейкстры, BFS, дельта-шага и Беллмана-Форда дают корректные пути до всех вершин и переживают сохранение
+    DirectedGraph<int> graph;
+    const int VERTICES = 400;
+    unsigned int seed = 31;
+    for (int v = 0; v < VERTICES; v++) 
+    {
+        for (int k = 0; k < 3; k++) 
+        {
+            int to = RandomBelow(seed, VERTICES);
+            graph.AddEdge(v, to, 0.1 * (1 + RandomBelow(seed, 10)));
+        }
+    }
+    graph.AddVertex(-1);
+    CsrGraph<int> csr(graph);
+    ThreadPool pool(3);
+
+    auto checkTree = [&](const ShortestPathTree<int>& tree, bool unweighted) 
+    {
+        ASSERT_EQ(tree.GetVertexCount(), csr.GetVertexCount());
+        EXPECT_EQ(tree.GetSource(), 0);
+        for (int i = 0; i < csr.GetVertexCount(); i++) 
+        {
+            int target = csr.GetVertex(i);
+            Sequence<int>* path = tree.GetPath(target);
+            if (!tree.HasPath(target)) 
+            {
+                EXPECT_EQ(path->GetLength(), 0);
+                delete path;
+                continue;
+            }
+            ASSERT_GT(path->GetLength(), 0);
+            EXPECT_EQ(path->GetFirst(), 0);
+            EXPECT_EQ(path->GetLast(), target);
+            double length = 0.0;
+            for (int k = 0; k + 1 < path->GetLength(); k++) 
+            {
+                ASSERT_TRUE(graph.HasEdge(path->Get(k), path->Get(k + 1)));
+                length += unweighted ? 1.0 : graph.GetEdgeWeight(path->Get(k), path->Get(k + 1));
+            }
+            EXPECT_NEAR(length, tree.GetDistance(target), 1e-9);
+            delete path;
+        }
+    };
+
+    ShortestPathTree<int> dijkstra = ShortestPath<int>::DijkstraTree(csr, 0);
+    checkTree(dijkstra, false);
+    checkTree(ShortestPath<int>::BFSTree(graph, 0), true);
+    checkTree(ShortestPath<int>::DeltaSteppingTree(csr, 0, pool), false);
+    checkTree(ShortestPath<int>::BellmanFordTree(csr, 0), false);
+    EXPECT_FALSE(dijkstra.HasPath(-1));
+    EXPECT_THROW(dijkstra.GetDistance(VERTICES), std::runtime_error);
+
+    std::stringstream stream;
+    dijkstra.Save(stream);
+    ShortestPathTree<int> loaded = ShortestPathTree<int>::Load(stream);
+    checkTree(loaded, false);
+    for (int i = 0; i < csr.GetVertexCount(); i++) 
+    {
+        EXPECT_EQ(loaded.GetDistance(csr.GetVertex(i)), dijkstra.GetDistance(csr.GetVertex(i)));
+    }
+    std::stringstream broken("SPTR");
+    EXPECT_THROW(ShortestPathTree<int>::Load(broken), std::runtime_error);
+}
+
+TEST(ShortestPathTest, ReconstructPathToleratesRounding) 
+{
+    // Проверяет: Восстановление пути по словарю расстояний с погрешностью округления и рёбрами нулевого веса
+    DirectedGraph<int> graph;
+    graph.AddEdge(1, 2, 0.1);
+    graph.AddEdge(2, 3, 0.2);
+    graph.AddEdge(3, 4, 0.0);
+    graph.AddEdge(4, 3, 0.0);
+    graph.AddEdge(4, 5, 0.7);
+    graph.AddEdge(1, 5, 5.0);
+
+    // Расстояния, посчитанные в другом порядке сложения, отличаются в последних битах
+    Dictionary<int, double> distances;
+    distances.Add(1, 0.0);
+    distances.Add(2, 0.1);
+    distances.Add(3, 0.3 * (1.0 + 1e-15));
+    distances.Add(4, 0.3);
+    distances.Add(5, 1.0);
+    Sequence<int>* path = ShortestPath<int>::ReconstructPath(graph, 1, 5, distances);
+    ASSERT_EQ(path->GetLength(), 5);
+    int expected[] = { 1, 2, 3, 4, 5 };
+    for (int i = 0; i < 5; i++) 
+    {
+        EXPECT_EQ(path->Get(i), expected[i]);
+    }
+    delete path;
+
+    // Расстояния не согласованы с графом - путь не восстанавливается
+    distances.Add(5, 0.5);
+    EXPECT_THROW(ShortestPath<int>::ReconstructPath(graph, 1, 5, distances), std::runtime_error);
+}
+
+TEST(ShortestPathTest, DISABLED_DijkstraPointQueriesBenchmark) 
+{
+    // Проверяет: Точечные запросы с ранней остановкой и общей рабочей памятью
+    const int SIDE = 300;
+    const int QUERIES = 1000;
+    UndirectedGraph<int> grid;
+    for (int r = 0; r < SIDE; r++) 
+    {
+        for (int c = 0; c < SIDE; c++) 
+        {
+            int v = r * SIDE + c;
+            if (c + 1 < SIDE) grid.AddEdge(v, v + 1, 1.0 + (v % 7));
+            if (r + 1 < SIDE) grid.AddEdge(v, v + SIDE, 1.0 + (v % 11));
+        }
+    }
+    CsrGraph<int> csr(grid);
+    DijkstraWorkspace workspace(csr.GetVertexCount());
+
+    unsigned int seed = 7;
+    long long settled = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int q = 0; q < QUERIES; q++) 
+    {
+        int source = RandomBelow(seed, SIDE * SIDE);
+        int dr = RandomBelow(seed, 21) - 10;
+        int dc = RandomBelow(seed, 21) - 10;
+        int r = std::min(SIDE - 1, std::max(0, source / SIDE + dr));
+        int c = std::min(SIDE - 1, std::max(0, source % SIDE + dc));
+        ShortestPath<int>::RunDijkstra(csr, source, r * SIDE + c, workspace);
+        settled += workspace.GetSettledCount();
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "[ BENCH    ] " << QUERIES << " local queries on " << SIDE * SIDE << " vertices: " << elapsed.count() << " ms, " << settled / QUERIES << " settled per query" << std::endl;
+
+    EXPECT_LT(settled / QUERIES, SIDE * SIDE / 4);
+}
+
+TEST(ShortestPathTest, BatchAndMultiSourceQueries) 
+{
+    // Проверяет: Пакет запросов совпадает с отдельными поисками, многоисточниковая Дейкстра даёт ближайший источник
+    DirectedGraph<int> graph;
+    const int VERTICES = 600;
+    unsigned int seed = 37;
+    BuildRandomGraph(graph, VERTICES, VERTICES * 3, seed, 50);
+    graph.AddVertex(VERTICES);
+    CsrGraph<int> csr(graph);
+    ThreadPool pool(3);
+
+    // Источники повторяются, чтобы запросы группировались
+    DynamicArray<std::pair<int, int>> queries;
+    for (int q = 0; q < 500; q++) 
+    {
+        int source = RandomBelow(seed, 20);
+        queries.PushBack(std::make_pair(source, RandomBelow(seed, VERTICES + 1)));
+    }
+    queries.PushBack(std::make_pair(VERTICES, 0));
+    DynamicArray<double> results(queries.GetSize());
+    ShortestPath<int>::BatchDistances(csr, queries, results.Data(), pool);
+    DijkstraWorkspace workspace;
+    for (int q = 0; q < queries.GetSize(); q++) 
+    {
+        EXPECT_EQ(results[q], ShortestPath<int>::ShortestDistance(csr, queries[q].first, queries[q].second, workspace));
+    }
+    queries.PushBack(std::make_pair(0, -7));
+    EXPECT_THROW(ShortestPath<int>::BatchDistances(csr, queries, results.Data(), pool), std::runtime_error);
+
+    DynamicArray<int> facilities;
+    facilities.PushBack(5);
+    facilities.PushBack(100);
+    facilities.PushBack(5);
+    facilities.PushBack(450);
+    DynamicArray<double> dist(csr.GetVertexCount());
+    DynamicArray<int> nearest(csr.GetVertexCount());
+    ShortestPath<int>::MultiSourceDijkstra(csr, facilities, dist.Data(), nearest.Data());
+    DynamicArray<DynamicArray<double>> single(facilities.GetSize());
+    for (int f = 0; f < facilities.GetSize(); f++) 
+    {
+        ShortestPath<int>::RunDijkstra(csr, csr.IndexOf(facilities[f]), -1, workspace);
+        single[f] = DynamicArray<double>(csr.GetVertexCount());
+        for (int v = 0; v < csr.GetVertexCount(); v++) single[f][v] = workspace.GetDistance(v);
+    }
+    for (int v = 0; v < csr.GetVertexCount(); v++) 
+    {
+        double best = std::numeric_limits<double>::infinity();
+        for (int f = 0; f < facilities.GetSize(); f++) best = std::min(best, single[f][v]);
+        EXPECT_EQ(dist[v], best);
+        if (best == std::numeric_limits<double>::infinity()) 
+        {
+            EXPECT_EQ(nearest[v], -1);
+        }
+        else 
+        {
+            ASSERT_GE(nearest[v], 0);
+            EXPECT_NE(nearest[v], 2);
+            EXPECT_EQ(single[nearest[v]][v], best);
+        }
+    }
+}
+
+TEST(ShortestPathTest, DISABLED_BatchQueriesBenchmark) 
+{
+    // Проверяет: Время пакета из 20000 запросов против отдельных вызовов Dijkstra со словарём
+    const int VERTICES = 20000;
+    const int QUERIES = 20000;
+    const int SOURCES = 50;
+    DirectedGraph<int> graph;
+    unsigned int seed = 41;
+    BuildRandomGraph(graph, VERTICES, VERTICES * 4, seed, 100);
+    CsrGraph<int> csr(graph);
+    DynamicArray<std::pair<int, int>> queries;
+    for (int q = 0; q < QUERIES; q++) 
+    {
+        int source = RandomBelow(seed, SOURCES) * 97;
+        queries.PushBack(std::make_pair(source, RandomBelow(seed, VERTICES)));
+    }
+
+    DynamicArray<double> results(QUERIES);
+    auto start = std::chrono::steady_clock::now();
+    ShortestPath<int>::BatchDistances(csr, queries, results.Data());
+    auto batchTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    // Отдельные вызовы на части запросов, время пересчитывается на весь пакет
+    const int SAMPLE = 200;
+    int mismatches = 0;
+    start = std::chrono::steady_clock::now();
+    for (int q = 0; q < SAMPLE; q++) 
+    {
+        Dictionary<int, double>* distances = ShortestPath<int>::Dijkstra(csr, queries[q].first);
+        if (distances->Get(queries[q].second) != results[q]) mismatches++;
+        delete distances;
+    }
+    auto sampleTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "[ BENCH    ] " << QUERIES << " queries from " << SOURCES << " sources: batch " << batchTime.count() << " ms, separate Dijkstra ~" << sampleTime.count() * (QUERIES / SAMPLE) << " ms" << std::endl;
+    EXPECT_EQ(mismatches, 0);
+}
+
+TEST(ShortestPathTest, BidirectionalAndAStarMatchDijkstra) 
+{
+    // Проверяет: Двунаправленная Дейкстра и A* находят пути той же длины, что и Дейкстра
+    DirectedGraph<int> graph;
+    const int VERTICES = 400;
+    unsigned int seed = 2024;
+    BuildRandomGraph(graph, VERTICES, VERTICES * 4, seed, 9);
+
+    CsrGraph<int> csr(graph);
+    CsrGraph<int> reverse = csr.Transpose();
+    EXPECT_EQ(reverse.GetArcCount(), csr.GetArcCount());
+    for (int u = 0; u < csr.GetVertexCount(); u += 50) 
+    {
+        auto neighbors = csr.GetNeighbors(u);
+        for (int i = 0; i < neighbors.GetCount(); i++) 
+        {
+            EXPECT_EQ(reverse.GetArcWeight(neighbors.Target(i), u), neighbors.Weight(i));
+        }
+    }
+
+    auto pathLength = [&graph](Sequence<int>* path) 
+    {
+        double length = 0.0;
+        for (int i = 0; i + 1 < path->GetLength(); i++) 
+        {
+            length += graph.GetEdgeWeight(path->Get(i), path->Get(i + 1));
+        }
+        return length;
+    };
+    auto zero = [](const int&, const int&) { return 0.0; };
+
+    BidirectionalWorkspace bidirectional;
+    DijkstraWorkspace astar;
+    for (int q = 0; q < 40; q++) 
+    {
+        int source = RandomBelow(seed, VERTICES);
+        int target = RandomBelow(seed, VERTICES);
+        auto distances = ShortestPath<int>::Dijkstra(csr, source);
+        double expected = distances->Get(target);
+        delete distances;
+
+        auto bidiPath = ShortestPath<int>::BidirectionalDijkstra(csr, reverse, source, target, bidirectional);
+        auto astarPath = ShortestPath<int>::AStar(csr, source, target, zero, astar);
+        if (expected == std::numeric_limits<double>::infinity()) 
+        {
+            EXPECT_EQ(bidiPath->GetLength(), 0);
+            EXPECT_EQ(astarPath->GetLength(), 0);
+        }
+        else 
+        {
+            ASSERT_GT(bidiPath->GetLength(), 0);
+            EXPECT_EQ(bidiPath->GetFirst(), source);
+            EXPECT_EQ(bidiPath->GetLast(), target);
+            EXPECT_EQ(pathLength(bidiPath), expected);
+            EXPECT_EQ(astarPath->GetLast(), target);
+            EXPECT_EQ(pathLength(astarPath), expected);
+        }
+        delete bidiPath;
+        delete astarPath;
+    }
+
+    // На решётке с манхэттенской эвристикой обе направленные версии извлекают меньше вершин, чем Дейкстра
+    const int SIDE = 40;
+    UndirectedGraph<int> grid;
+    for (int r = 0; r < SIDE; r++) 
+    {
+        for (int c = 0; c < SIDE; c++) 
+        {
+            int v = r * SIDE + c;
+            if (c + 1 < SIDE) grid.AddEdge(v, v + 1, 1.0 + (v % 4));
+            if (r + 1 < SIDE) grid.AddEdge(v, v + SIDE, 1.0 + (v % 3));
+        }
+    }
+    auto manhattan = [SIDE](const int& a, const int& b) 
+    {
+        return static_cast<double>(std::abs(a / SIDE - b / SIDE) + std::abs(a % SIDE - b % SIDE));
+    };
+    CsrGraph<int> gridCsr(grid);
+    CsrGraph<int> gridReverse = gridCsr.Transpose();
+    DijkstraWorkspace dijkstra;
+    long long settled[3] = { 0, 0, 0 };
+    for (int q = 0; q < 20; q++) 
+    {
+        int source = RandomBelow(seed, SIDE * SIDE);
+        int target = RandomBelow(seed, SIDE * SIDE);
+        double expected = ShortestPath<int>::RunDijkstra(gridCsr, source, target, dijkstra);
+        settled[0] += dijkstra.GetSettledCount();
+
+        int meetForward = -1;
+        int meetBackward = -1;
+        EXPECT_EQ(ShortestPath<int>::RunBidirectionalDijkstra(gridCsr, gridReverse, source, target, bidirectional, meetForward, meetBackward), expected);
+        settled[1] += bidirectional.GetSettledCount();
+        EXPECT_EQ(ShortestPath<int>::RunAStar(gridCsr, source, target, manhattan, astar), expected);
+        settled[2] += astar.GetSettledCount();
+    }
+    EXPECT_LT(settled[1], settled[0]);
+    EXPECT_LE(settled[2], settled[0]);
+
+    auto same = ShortestPath<int>::BidirectionalDijkstra(graph, 5, 5);
+    ASSERT_EQ(same->GetLength(), 1);
+    EXPECT_EQ(same->Get(0), 5);
+    delete same;
+    EXPECT_THROW(ShortestPath<int>::BidirectionalDijkstra(graph, 5, VERTICES + 1), std::runtime_error);
+}
+
+TEST(ShortestPathTest, DISABLED_PointToPointSearchBenchmark) 
+{
+    // Проверяет: Число извлечённых вершин и время Дейкстры, двунаправленной Дейкстры и A*
+    const int SIDE = 300;
+    const int QUERIES = 50;
+    UndirectedGraph<int> grid;
+    for (int r = 0; r < SIDE; r++) 
+    {
+        for (int c = 0; c < SIDE; c++) 
+        {
+            int v = r * SIDE + c;
+            if (c + 1 < SIDE) grid.AddEdge(v, v + 1, 1.0 + (v % 4));
+            if (r + 1 < SIDE) grid.AddEdge(v, v + SIDE, 1.0 + (v % 3));
+        }
+    }
+    DirectedGraph<int> random;
+    const int RANDOM_VERTICES = 50000;
+    unsigned int seed = 99;
+    BuildRandomGraph(random, RANDOM_VERTICES, RANDOM_VERTICES * 4, seed, 10);
+
+    // Манхэттенское расстояние допустимо: вес каждого ребра решётки не меньше 1
+    auto manhattan = [SIDE](const int& a, const int& b) 
+    {
+        return static_cast<double>(std::abs(a / SIDE - b / SIDE) + std::abs(a % SIDE - b % SIDE));
+    };
+    auto zero = [](const int&, const int&) { return 0.0; };
+
+    struct Workload 
+    {
+        const char* name;
+        CsrGraph<int> csr;
+        std::function<double(const int&, const int&)> heuristic;
+    };
+    Workload workloads[] = 
+    {
+        { "grid", CsrGraph<int>(grid), manhattan },
+        { "random", CsrGraph<int>(random), zero },
+    };
+
+    for (Workload& workload : workloads) 
+    {
+        CsrGraph<int> reverse = workload.csr.Transpose();
+        int n = workload.csr.GetVertexCount();
+        DijkstraWorkspace dijkstra(n);
+        DijkstraWorkspace astar(n);
+        BidirectionalWorkspace bidirectional;
+        long long settled[3] = { 0, 0, 0 };
+        long long micros[3] = { 0, 0, 0 };
+
+        for (int q = 0; q < QUERIES; q++) 
+        {
+            int source = RandomBelow(seed, n);
+            int target = RandomBelow(seed, n);
+
+            auto start = std::chrono::steady_clock::now();
+            double expected = ShortestPath<int>::RunDijkstra(workload.csr, source, target, dijkstra);
+            micros[0] += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            settled[0] += dijkstra.GetSettledCount();
+
+            int meetForward = -1;
+            int meetBackward = -1;
+            start = std::chrono::steady_clock::now();
+            double bidi = ShortestPath<int>::RunBidirectionalDijkstra(workload.csr, reverse, source, target, bidirectional, meetForward, meetBackward);
+            micros[1] += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            settled[1] += bidirectional.GetSettledCount();
+
+            start = std::chrono::steady_clock::now();
+            double heuristicDistance = ShortestPath<int>::RunAStar(workload.csr, source, target, workload.heuristic, astar);
+            micros[2] += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            settled[2] += astar.GetSettledCount();
+
+            EXPECT_EQ(bidi, expected);
+            EXPECT_EQ(heuristicDistance, expected);
+        }
+
+        std::cout << "[ BENCH    ] " << workload.name << " (" << n << " vertices), avg settled / ms per query: Dijkstra "
+                  << settled[0] / QUERIES << " / " << micros[0] / QUERIES / 1000.0
+                  << ", bidirectional " << settled[1] / QUERIES << " / " << micros[1] / QUERIES / 1000.0
+                  << ", A* " << settled[2] / QUERIES << " / " << micros[2] / QUERIES / 1000.0 << std::endl;
+        EXPECT_LT(settled[1], settled[0]);
+        EXPECT_LE(settled[2], settled[0]);
     }
-    delete sortedKahn;
 }
 
-TEST(TopologicalSortTest, GraphWithCycle) 
+TEST(ShortestPathTest, EccentricitiesMatchSerialComputation) 
 {
-    // Проверяет: Обработку графа с циклом при топологической сортировке
-    DirectedGraph<int> graph;
-    
-    graph.AddEdge(1, 2);
-    graph.AddEdge(2, 3);
-    graph.AddEdge(3, 1);
-    
-    EXPECT_FALSE(TopologicalSort<int>::IsAcyclic(graph));
-    
-    EXPECT_THROW(TopologicalSort<int>::KahnSort(graph), std::runtime_error);
-    EXPECT_THROW(TopologicalSort<int>::DFSSort(graph), std::runtime_error);
+    // Проверяет: Диаметр, радиус, центр и периферия за один проход совпадают с последовательным перебором
+    UndirectedGraph<int> path;
+    for (int v = 0; v < 6; v++) 
+    {
+        path.AddEdge(v, v + 1, 1.0);
+    }
+    auto report = ShortestPath<int>::ComputeEccentricities(path);
+    EXPECT_EQ(report.GetDiameter(), 6.0);
+    EXPECT_EQ(report.GetRadius(), 3.0);
+    ASSERT_EQ(report.GetCenter().GetSize(), 1);
+    EXPECT_EQ(report.GetCenter()[0], 3);
+    ASSERT_EQ(report.GetPeriphery().GetSize(), 2);
+    EXPECT_EQ(report.GetPeriphery()[0], 0);
+    EXPECT_EQ(report.GetPeriphery()[1], 6);
+
+    DirectedGraph<int> random;
+    const int VERTICES = 400;
+    BuildRandomGraph(random, VERTICES, VERTICES * 3, 5, 9);
+    CsrGraph<int> csr(random);
+    DijkstraWorkspace workspace(csr.GetVertexCount());
+    ThreadPool pool(3);
+    auto parallel = ShortestPath<int>::ComputeEccentricities(csr, pool);
+    double diameter = 0.0;
+    for (int v = 0; v < csr.GetVertexCount(); v++) 
+    {
+        ShortestPath<int>::RunDijkstra(csr, v, -1, workspace);
+        double eccentricity = 0.0;
+        for (int i = 0; i < workspace.GetReachedCount(); i++) 
+        {
+            eccentricity = std::max(eccentricity, workspace.GetDistance(workspace.GetReached(i)));
+        }
+        EXPECT_EQ(parallel.GetEccentricity(v), eccentricity);
+        diameter = std::max(diameter, eccentricity);
+    }
+    EXPECT_EQ(parallel.GetDiameter(), diameter);
+    EXPECT_EQ(ShortestPath<int>::GetGraphDiameter(random), diameter);
 }
 
-TEST(TopologicalSortTest, ComplexDAG) 
+TEST(ShortestPathTest, DISABLED_EccentricityThreadScalingBenchmark) 
 {
-    // Проверяет: Топологическую сортировку сложного ациклического графа
-    DirectedGraph<std::string> graph;
-    
-    graph.AddEdge("A", "B");
-    graph.AddEdge("A", "C");
-    graph.AddEdge("B", "D");
-    graph.AddEdge("C", "D");
-    graph.AddEdge("D", "E");
-    graph.AddEdge("D", "F");
-    
-    auto sorted = TopologicalSort<std::string>::KahnSort(graph);
-    EXPECT_EQ(sorted->GetLength(), 6);
-    
-    bool foundA = false, foundE = false;
-    for (int i = 0; i < sorted->GetLength(); i++) {
-        if (sorted->Get(i) == "A") foundA = true;
-        if (sorted->Get(i) == "E") foundE = true;
+    // Проверяет: Время всех Дейкстр при разном числе потоков пула и одинаковость результата
+    const int VERTICES = 2000;
+    DirectedGraph<int> graph;
+    BuildRandomGraph(graph, VERTICES, VERTICES * 3, 17, 10);
+    for (int v = 0; v < VERTICES; v++) graph.AddEdge(v, (v + 1) % VERTICES, 1.0);
+    CsrGraph<int> csr(graph);
+
+    int hardware = static_cast<int>(std::thread::hardware_concurrency());
+    int threadCounts[] = { 1, 2, std::max(4, hardware) };
+    double baseline = -1.0;
+    long long baselineMs = 0;
+    for (int threads : threadCounts) 
+    {
+        ThreadPool pool(threads);
+        auto start = std::chrono::steady_clock::now();
+        auto report = ShortestPath<int>::ComputeEccentricities(csr, pool);
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        if (baseline < 0.0) 
+        {
+            baseline = report.GetDiameter();
+            baselineMs = elapsed;
+        }
+        std::cout << "[ BENCH    ] eccentricities of " << VERTICES << " vertices, " << threads << " threads: " << elapsed << " ms (x" << (elapsed > 0 ? static_cast<double>(baselineMs) / elapsed : 1.0) << ")" << std::endl;
+        EXPECT_EQ(report.GetDiameter(), baseline);
+        EXPECT_GT(report.GetCenter().GetSize(), 0);
     }
-    EXPECT_TRUE(foundA);
-    EXPECT_TRUE(foundE);
-    
-    delete sorted;
 }
 
-// 9. Тесты для ShortestPath
+TEST(ShortestPathTest, DiameterAndRadiusBoundsContainExactValues) 
+{
+    // Проверяет: Двойной проход, iFUB и границы эксцентриситетов против точного перебора, в том числе с лимитом поисков
+    UndirectedGraph<int> undirected;
+    DirectedGraph<int> directed;
+    const int VERTICES = 300;
+    unsigned int seed = 23;
+    for (int v = 0; v < VERTICES; v++) 
+    {
+        NextRandom(seed);
+        // Две компоненты: чётные и нечётные вершины, у каждой - путь и случайные хорды
+        int next = v + 2;
+        if (next < VERTICES) undirected.AddEdge(v, next, 1.0 + (seed >> 24) % 5);
+        int chord = static_cast<int>((seed >> 4) % VERTICES);
+        if ((chord - v) % 2 == 0 && v % 7 == 0) undirected.AddEdge(v, chord, 1.0 + (seed >> 20) % 9);
+        directed.AddEdge(v, (v + 1) % VERTICES, 1.0 + (seed >> 24) % 5);
+        directed.AddEdge(v, chord, 2.0 + (seed >> 20) % 9);
+    }
+    undirected.AddVertex(VERTICES);
 
-TEST(ShortestPathTest, SingleVertexGraph) 
+    for (int pass = 0; pass < 2; pass++) 
+    {
+        CsrGraph<int> csr = pass == 0 ? CsrGraph<int>(undirected) : CsrGraph<int>(directed);
+        auto exact = ShortestPath<int>::ComputeEccentricities(csr);
+
+        DistanceBounds diameter = ShortestPath<int>::BoundDiameter(csr);
+        EXPECT_TRUE(diameter.IsExact());
+        EXPECT_EQ(diameter.GetLower(), exact.GetDiameter());
+
+        auto bounds = ShortestPath<int>::BoundEccentricities(csr);
+        EXPECT_EQ(bounds.GetDiameter().GetLower(), exact.GetDiameter());
+        EXPECT_EQ(bounds.GetDiameter().GetUpper(), exact.GetDiameter());
+        EXPECT_EQ(bounds.GetRadius().GetLower(), exact.GetRadius());
+        EXPECT_EQ(bounds.GetRadius().GetUpper(), exact.GetRadius());
+        for (int v = 0; v < csr.GetVertexCount(); v++) 
+        {
+            EXPECT_LE(bounds.GetLower(v), exact.GetEccentricity(v));
+            EXPECT_GE(bounds.GetUpper(v), exact.GetEccentricity(v));
+        }
+
+        DistanceBounds sweep = ShortestPath<int>::DoubleSweepDiameter(csr);
+        EXPECT_LE(sweep.GetLower(), exact.GetDiameter());
+        EXPECT_GE(sweep.GetUpper(), exact.GetDiameter());
+
+        ApproximationOptions limited(0.0, 0.0, 4);
+        DistanceBounds partial = ShortestPath<int>::BoundDiameter(csr, limited);
+        EXPECT_LE(partial.GetLower(), exact.GetDiameter());
+        EXPECT_GE(partial.GetUpper(), exact.GetDiameter());
+        DistanceBounds partialRadius = ShortestPath<int>::BoundRadius(csr, limited);
+        EXPECT_LE(partialRadius.GetLower(), exact.GetRadius());
+        EXPECT_GE(partialRadius.GetUpper(), exact.GetRadius());
+        EXPECT_LE(partialRadius.GetSearchCount(), 4);
+    }
+
+    // На графе с вершинами-хабами iFUB доказывает точный диаметр малой долей поисков,
+    // а границы с допуском 10% содержат точные значения
+    const int HUBBED = 2000;
+    UndirectedGraph<int> hubbed;
+    std::vector<int> ends = { 0, 1 };
+    hubbed.AddEdge(0, 1);
+    for (int v = 2; v < HUBBED; v++) 
+    {
+        for (int k = 0; k < 2; k++) 
+        {
+            int target = ends[RandomBelow(seed, static_cast<int>(ends.size()))];
+            hubbed.AddEdge(v, target, 1.0 + RandomBelow(seed, 10));
+            ends.push_back(v);
+            ends.push_back(target);
+        }
+    }
+    CsrGraph<int> hubbedCsr(hubbed);
+    auto hubbedExact = ShortestPath<int>::ComputeEccentricities(hubbedCsr);
+    DistanceBounds hubbedDiameter = ShortestPath<int>::BoundDiameter(hubbedCsr);
+    EXPECT_TRUE(hubbedDiameter.IsExact());
+    EXPECT_EQ(hubbedDiameter.GetLower(), hubbedExact.GetDiameter());
+    EXPECT_LT(hubbedDiameter.GetSearchCount(), HUBBED / 10);
+
+    ApproximationOptions tolerance(0.1, 3.0);
+    DistanceBounds approximate = ShortestPath<int>::BoundDiameter(hubbedCsr, tolerance);
+    EXPECT_LE(approximate.GetLower(), hubbedExact.GetDiameter());
+    EXPECT_GE(approximate.GetUpper(), hubbedExact.GetDiameter());
+    auto approximateBounds = ShortestPath<int>::BoundEccentricities(hubbedCsr, tolerance);
+    EXPECT_LE(approximateBounds.GetRadius().GetLower(), hubbedExact.GetRadius());
+    EXPECT_GE(approximateBounds.GetRadius().GetUpper(), hubbedExact.GetRadius());
+
+    DirectedGraph<int> empty;
+    EXPECT_TRUE(ShortestPath<int>::BoundDiameter(CsrGraph<int>(empty)).IsExact());
+}
+
+TEST(ShortestPathTest, DISABLED_BoundedDiameterBenchmark) 
 {
-    // Проверяет: Кратчайшие пути в графе с одной вершиной
+    // Проверяет: iFUB и границы эксцентриситетов на графах с предпочтительным присоединением обходятся малой долей поисков
+    auto buildGraph = [](int vertices, UndirectedGraph<int>& graph) 
+    {
+        // Новая вершина соединяется с концами случайных уже имеющихся рёбер: появляются вершины-хабы
+        std::vector<int> ends = { 0, 1 };
+        graph.AddEdge(0, 1);
+        unsigned int seed = 41;
+        for (int v = 2; v < vertices; v++) 
+        {
+            for (int k = 0; k < 2; k++) 
+            {
+                int target = ends[RandomBelow(seed, static_cast<int>(ends.size()))];
+                graph.AddEdge(v, target, 1.0 + RandomBelow(seed, 10));
+                ends.push_back(v);
+                ends.push_back(target);
+            }
+        }
+    };
+
+    const int SMALL = 20000;
+    UndirectedGraph<int> small;
+    buildGraph(SMALL, small);
+    CsrGraph<int> smallCsr(small);
+    auto start = std::chrono::steady_clock::now();
+    DistanceBounds exact = ShortestPath<int>::BoundDiameter(smallCsr);
+    auto exactTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    EXPECT_TRUE(exact.IsExact());
+    EXPECT_LT(exact.GetSearchCount(), SMALL / 10);
+    std::cout << "[ BENCH    ] exact diameter of " << SMALL << " vertices: " << exact.GetLower() << " after " << exact.GetSearchCount() << " searches / " << exactTime.count() << " ms" << std::endl;
+
+    const int LARGE = 200000;
+    UndirectedGraph<int> large;
+    buildGraph(LARGE, large);
+    CsrGraph<int> csr(large);
+    ApproximationOptions options(0.1, 3.0);
+
+    start = std::chrono::steady_clock::now();
+    DistanceBounds diameter = ShortestPath<int>::BoundDiameter(csr, options);
+    auto diameterTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    start = std::chrono::steady_clock::now();
+    auto eccentricities = ShortestPath<int>::BoundEccentricities(csr, options);
+    auto eccentricityTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    const DistanceBounds& radius = eccentricities.GetRadius();
+    std::cout << "[ BENCH    ] " << LARGE << " vertices, tolerance 10%: diameter in [" << diameter.GetLower() << ", " << diameter.GetUpper() << "] after " << diameter.GetSearchCount() << " searches / " << diameterTime.count() << " ms, radius in [" << radius.GetLower() << ", " << radius.GetUpper() << "] after " << radius.GetSearchCount() << " searches / " << eccentricityTime.count() << " ms" << std::endl;
+
+    EXPECT_LE(diameter.GetLower(), diameter.GetUpper());
+    EXPECT_LE(radius.GetLower(), radius.GetUpper());
+    EXPECT_LE(eccentricities.GetDiameter().GetLower(), diameter.GetUpper());
+    EXPECT_LE(diameter.GetLower(), eccentricities.GetDiameter().GetUpper());
+}
+
+TEST(ShortestPathTest, DeltaSteppingMatchesDijkstra) 
+{
+    // Проверяет: Дельта-шаг при разной ширине корзин и числе потоков даёт расстояния Дейкстры
     DirectedGraph<int> graph;
-    graph.AddVertex(1);
-    
-    auto distances = ShortestPath<int>::Dijkstra(graph, 1);
-    EXPECT_EQ(distances->GetCount(), 1);
-    EXPECT_EQ(distances->Get(1), 0.0);
-    
-    auto path = ShortestPath<int>::FindShortestPath(graph, 1, 1);
-    EXPECT_EQ(path->GetLength(), 1);
-    EXPECT_EQ(path->Get(0), 1);
-    
+    const int VERTICES = 3000;
+    unsigned int seed = 7;
+    for (int v = 0; v < VERTICES; v++) 
+    {
+        for (int k = 0; k < 4; k++) 
+        {
+            int to = RandomBelow(seed, VERTICES);
+            graph.AddEdge(v, to, RandomBelow(seed, 20) * 0.5);
+        }
+    }
+    graph.AddVertex(VERTICES);
+    CsrGraph<int> csr(graph);
+    DijkstraWorkspace workspace(csr.GetVertexCount());
+    ShortestPath<int>::RunDijkstra(csr, 0, -1, workspace);
+
+    ThreadPool single(1);
+    ThreadPool several(4);
+    double deltas[] = { 0.0, 0.25, 3.0, 1000.0 };
+    for (double delta : deltas) 
+    {
+        for (ThreadPool* pool : { &single, &several }) 
+        {
+            DynamicArray<double> dist;
+            ShortestPath<int>::RunDeltaStepping(csr, 0, dist, *pool, delta);
+            ASSERT_EQ(dist.GetSize(), csr.GetVertexCount());
+            for (int v = 0; v < csr.GetVertexCount(); v++) 
+            {
+                EXPECT_EQ(dist[v], workspace.GetDistance(v));
+            }
+        }
+    }
+
+    auto distances = ShortestPath<int>::DeltaStepping(graph, 0);
+    EXPECT_EQ(distances->Get(VERTICES), std::numeric_limits<double>::infinity());
+    EXPECT_EQ(distances->Get(0), 0.0);
     delete distances;
-    delete path;
+
+    // Путь с большим диаметром открывает корзину на каждом шаге; слишком узкие корзины расширяются
+    const int PATH = 40000;
+    UndirectedGraph<int> path;
+    for (int v = 0; v + 1 < PATH; v++) 
+    {
+        path.AddEdge(v, v + 1);
+    }
+    CsrGraph<int> pathCsr(path);
+    double pathDeltas[] = { 0.0, 1e-300 };
+    for (double delta : pathDeltas) 
+    {
+        DynamicArray<double> dist;
+        ShortestPath<int>::RunDeltaStepping(pathCsr, 0, dist, several, delta);
+        int wrong = 0;
+        for (int v = 0; v < PATH; v++) 
+        {
+            if (dist[pathCsr.IndexOf(v)] != v) wrong++;
+        }
+        EXPECT_EQ(wrong, 0);
+    }
+
+    DirectedGraph<int> negative;
+    negative.AddEdge(1, 2, -1.0);
+    EXPECT_THROW(ShortestPath<int>::DeltaStepping(negative, 1), std::runtime_error);
+    EXPECT_THROW(ShortestPath<int>::DeltaStepping(negative, 5), std::runtime_error);
 }
 
-TEST(ShortestPathTest, SimpleWeightedGraph) 
+TEST(ShortestPathTest, DISABLED_DeltaSteppingThreadScalingBenchmark) 
 {
-    // Проверяет: Кратчайшие пути во взвешенном графе
-    DirectedGraph<std::string> graph;
-    
-    graph.AddEdge("A", "B", 1.0);
-    graph.AddEdge("A", "C", 4.0);
-    graph.AddEdge("B", "C", 2.0);
-    graph.AddEdge("B", "D", 5.0);
-    graph.AddEdge("C", "D", 1.0);
-    
-    auto distances = ShortestPath<std::string>::Dijkstra(graph, "A");
-    
-    EXPECT_EQ(distances->Get("A"), 0.0);
-    EXPECT_EQ(distances->Get("B"), 1.0);
-    EXPECT_EQ(distances->Get("C"), 3.0);
-    EXPECT_EQ(distances->Get("D"), 4.0);
-    
-    auto path = ShortestPath<std::string>::FindShortestPath(graph, "A", "D");
-    EXPECT_EQ(path->GetLength(), 4);
-    EXPECT_EQ(path->Get(0), "A");
-    EXPECT_EQ(path->Get(1), "B");
-    EXPECT_EQ(path->Get(2), "C");
-    EXPECT_EQ(path->Get(3), "D");
-    
-    delete distances;
-    delete path;
+    // Проверяет: Время дельта-шага на 1, 2, 4, 8 и 16 потоках против последовательной Дейкстры
+    const int VERTICES = 300000;
+    DirectedGraph<int> graph;
+    BuildRandomGraph(graph, VERTICES, VERTICES * 4, 13, 100);
+    CsrGraph<int> csr(graph);
+
+    DijkstraWorkspace workspace(VERTICES);
+    auto start = std::chrono::steady_clock::now();
+    ShortestPath<int>::RunDijkstra(csr, 0, -1, workspace);
+    auto dijkstraTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "[ BENCH    ] " << VERTICES << " vertices: Dijkstra " << dijkstraTime.count() << " ms, delta " << ShortestPath<int>::ChooseDelta(csr) << std::endl;
+
+    for (int threads : { 1, 2, 4, 8, 16 }) 
+    {
+        ThreadPool pool(threads);
+        DynamicArray<double> dist;
+        start = std::chrono::steady_clock::now();
+        ShortestPath<int>::RunDeltaStepping(csr, 0, dist, pool);
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << "[ BENCH    ] delta-stepping, " << threads << " threads: " << elapsed.count() << " ms" << std::endl;
+
+        int mismatches = 0;
+        for (int v = 0; v < VERTICES; v++) 
+        {
+            if (dist[v] != workspace.GetDistance(v)) mismatches++;
+        }
+        EXPECT_EQ(mismatches, 0);
+    }
 }
 
-TEST(ShortestPathTest, BFSUnweightedGraph) 
+TEST(ShortestPathTest, AllPairsMatchSingleSource) 
 {
-    // Проверяет: Кратчайшие пути в невзвешенном графе с помощью BFS
+    // Проверяет: Флойд-Уоршелл и Джонсон совпадают с Беллманом-Фордом из каждой вершины, в том числе при отрицательных дугах
+    DirectedGraph<int> graph;
+    const int VERTICES = 150;
+    unsigned int seed = 23;
+    for (int v = 0; v < VERTICES; v++) 
+    {
+        for (int k = 0; k < 3; k++) 
+        {
+            int to = RandomBelow(seed, VERTICES);
+            graph.AddEdge(v * 7, to * 7, 1.0 + RandomBelow(seed, 10) + (v % 13) - (to % 13));
+        }
+    }
+    graph.AddVertex(-1);
+    CsrGraph<int> csr(graph);
+    ThreadPool pool(3);
+    DistanceMatrix<int> floyd = AllPairsShortestPaths<int>::FloydWarshall(csr, pool);
+    DistanceMatrix<int> johnson = AllPairsShortestPaths<int>::Johnson(csr, pool);
+    ASSERT_EQ(floyd.GetVertexCount(), VERTICES + 1);
+
+    int mismatches = 0;
+    for (int s = 0; s < csr.GetVertexCount(); s++) 
+    {
+        auto reference = ShortestPath<int>::RunBellmanFord(csr, s);
+        for (int v = 0; v < csr.GetVertexCount(); v++) 
+        {
+            double expected = reference.GetDistance(v);
+            if (std::abs(floyd.Get(s, v) - expected) > 1e-9 && floyd.Get(s, v) != expected) mismatches++;
+            if (std::abs(johnson.Get(s, v) - expected) > 1e-9 && johnson.Get(s, v) != expected) mismatches++;
+        }
+    }
+    EXPECT_EQ(mismatches, 0);
+    EXPECT_EQ(floyd.GetDistance(-1, -1), 0.0);
+    EXPECT_FALSE(floyd.HasPath(0, -1));
+    EXPECT_THROW(floyd.GetDistance(0, 1), std::runtime_error);
+
+    // Неотрицательные веса: Джонсон обходится без потенциалов и совпадает с Дейкстрой
+    UndirectedGraph<int> undirected;
+    for (int v = 0; v < VERTICES; v++) 
+    {
+        int to = RandomBelow(seed, VERTICES);
+        undirected.AddEdge(v, to, 1.0 + RandomBelow(seed, 10));
+        undirected.AddEdge(v, (v + 1) % VERTICES, 5.0);
+    }
+    CsrGraph<int> undirectedCsr(undirected);
+    DistanceMatrix<int> fw = AllPairsShortestPaths<int>::FloydWarshall(undirectedCsr, pool);
+    DistanceMatrix<int> jn = AllPairsShortestPaths<int>::Compute(undirectedCsr, pool);
+    DijkstraWorkspace workspace;
+    for (int s = 0; s < undirectedCsr.GetVertexCount(); s++) 
+    {
+        ShortestPath<int>::RunDijkstra(undirectedCsr, s, -1, workspace);
+        for (int v = 0; v < undirectedCsr.GetVertexCount(); v++) 
+        {
+            EXPECT_EQ(fw.Get(s, v), workspace.GetDistance(v));
+            EXPECT_EQ(jn.Get(s, v), workspace.GetDistance(v));
+        }
+    }
+
+    DirectedGraph<int> cyclic;
+    cyclic.AddEdge(1, 2, 1.0);
+    cyclic.AddEdge(2, 3, -3.0);
+    cyclic.AddEdge(3, 1, 1.0);
+    CsrGraph<int> cyclicCsr(cyclic);
+    EXPECT_THROW(AllPairsShortestPaths<int>::FloydWarshall(cyclicCsr, pool), std::runtime_error);
+    EXPECT_THROW(AllPairsShortestPaths<int>::Johnson(cyclicCsr, pool), std::runtime_error);
+}
+
+TEST(ShortestPathTest, DistanceMatrixSaveAndLoad) 
+{
+    // Проверяет: Матрица расстояний сохраняется и загружается без потерь, повреждённый заголовок отвергается
     UndirectedGraph<int> graph;
-    
-    graph.AddEdge(1, 2);
-    graph.AddEdge(1, 3);
-    graph.AddEdge(2, 4);
-    graph.AddEdge(3, 4);
-    graph.AddEdge(4, 5);
-    
-    auto distances = ShortestPath<int>::BFSShortestPath(graph, 1);
-    
-    EXPECT_EQ(distances->Get(1), 0.0);
-    EXPECT_EQ(distances->Get(2), 1.0);
-    EXPECT_EQ(distances->Get(3), 1.0);
-    EXPECT_EQ(distances->Get(4), 2.0);
-    EXPECT_EQ(distances->Get(5), 3.0);
-    
-    delete distances;
+    graph.AddEdge(10, 20, 1.5);
+    graph.AddEdge(20, 30, 2.0);
+    graph.AddVertex(40);
+    DistanceMatrix<int> matrix = AllPairsShortestPaths<int>::Compute(graph);
+
+    std::stringstream stream;
+    matrix.Save(stream);
+    EXPECT_EQ(static_cast<long long>(stream.str().size()), DistanceMatrix<int>::GetDataOffset(4) + 16 * static_cast<long long>(sizeof(double)));
+    DistanceMatrix<int> loaded = DistanceMatrix<int>::Load(stream);
+    ASSERT_EQ(loaded.GetVertexCount(), 4);
+    for (int i = 0; i < 4; i++) 
+    {
+        EXPECT_EQ(loaded.GetVertex(i), matrix.GetVertex(i));
+        for (int j = 0; j < 4; j++) 
+        {
+            EXPECT_EQ(loaded.Get(i, j), matrix.Get(i, j));
+        }
+    }
+    EXPECT_EQ(loaded.GetDistance(10, 30), 3.5);
+    EXPECT_FALSE(loaded.HasPath(10, 40));
+    EXPECT_EQ(loaded.GetEccentricity(loaded.IndexOf(20)), 2.0);
+
+    std::stringstream broken("XXXX0000");
+    EXPECT_THROW(DistanceMatrix<int>::Load(broken), std::runtime_error);
+
+    // V * V ячеек должны помещаться в int: больший заголовок отвергается до выделения памяти
+    std::string header = stream.str().substr(0, 16);
+    uint32_t tooMany = 46341;
+    header.replace(8, sizeof(tooMany), reinterpret_cast<const char*>(&tooMany), sizeof(tooMany));
+    std::stringstream huge(header);
+    EXPECT_THROW(DistanceMatrix<int>::Load(huge), std::length_error);
+    UndirectedGraph<int> wide;
+    for (int v = 0; v < 46341; v++) wide.AddVertex(v);
+    EXPECT_THROW(DistanceMatrix<int>(CsrGraph<int>(wide)), std::length_error);
+}
+
+TEST(ShortestPathTest, DISABLED_AllPairsBenchmark) 
+{
+    // Проверяет: Время блочного Флойда-Уоршелла и Джонсона на плотном и разреженном графах
+    const int VERTICES = 1000;
+    const int degrees[] = { 400, 4 };
+    for (int degree : degrees) 
+    {
+        DirectedGraph<int> graph;
+        BuildRandomGraph(graph, VERTICES, VERTICES * degree, 29, 100);
+        CsrGraph<int> csr(graph);
+
+        auto start = std::chrono::steady_clock::now();
+        DistanceMatrix<int> floyd = AllPairsShortestPaths<int>::FloydWarshall(csr);
+        auto floydTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        start = std::chrono::steady_clock::now();
+        DistanceMatrix<int> johnson = AllPairsShortestPaths<int>::Johnson(csr);
+        auto johnsonTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << "[ BENCH    ] " << VERTICES << " vertices, " << csr.GetArcCount() << " arcs: Floyd-Warshall " << floydTime.count() << " ms, Johnson " << johnsonTime.count() << " ms" << std::endl;
+
+        int mismatches = 0;
+        for (int i = 0; i < VERTICES; i++) 
+        {
+            for (int j = 0; j < VERTICES; j++) 
+            {
+                if (floyd.Get(i, j) != johnson.Get(i, j)) mismatches++;
+            }
+        }
+        EXPECT_EQ(mismatches, 0);
+    }
 }
 
-TEST(ShortestPathTest, BellmanFordNegativeWeights) 
+TEST(ShortestPathTest, MultiSourceBFSMatchesSingleSource) 
 {
-    // Проверяет: Алгоритм Беллмана-Форда для графов с отрицательными весами
+    // Проверяет: MS-BFS даёт те же расстояния, эксцентриситеты и близость, что BFS из каждой вершины
     DirectedGraph<int> graph;
-    
-    graph.AddEdge(1, 2, 6.0);
-    graph.AddEdge(1, 3, 5.0);
-    graph.AddEdge(1, 4, 5.0);
-    graph.AddEdge(2, 5, -1.0);
-    graph.AddEdge(3, 2, -2.0);
-    graph.AddEdge(3, 5, 1.0);
-    graph.AddEdge(4, 3, -2.0);
-    graph.AddEdge(4, 6, -1.0);
-    graph.AddEdge(5, 7, 3.0);
-    graph.AddEdge(6, 7, 3.0);
-    
-    auto distances = ShortestPath<int>::BellmanFord(graph, 1);
-    
-    EXPECT_EQ(distances->Get(1), 0.0);
-    EXPECT_EQ(distances->Get(2), 1.0);
-    EXPECT_EQ(distances->Get(3), 3.0);
-    EXPECT_EQ(distances->Get(4), 5.0);
-    EXPECT_EQ(distances->Get(5), 0.0);
-    EXPECT_EQ(distances->Get(6), 4.0);
-    EXPECT_EQ(distances->Get(7), 3.0);
-    
-    delete distances;
+    const int VERTICES = 300;
+    BuildRandomGraph(graph, VERTICES, VERTICES * 2, 43, 7);
+    graph.AddVertex(VERTICES);
+    CsrGraph<int> csr(graph);
+    int n = csr.GetVertexCount();
+    ThreadPool pool(3);
+
+    DynamicArray<DynamicArray<double>> reference(n);
+    for (int s = 0; s < n; s++) 
+    {
+        Dictionary<int, double>* dist = ShortestPath<int>::BFSShortestPath(csr, csr.GetVertex(s));
+        reference[s] = DynamicArray<double>(n);
+        for (int v = 0; v < n; v++) reference[s][v] = dist->Get(csr.GetVertex(v));
+        delete dist;
+    }
+
+    // Расстояния из одного пакета, включая повторный источник
+    int sources[] = { 0, 5, 17, 5, n - 1 };
+    MultiSourceBFSWorkspace workspace;
+    DynamicArray<DynamicArray<double>> found(5);
+    for (int i = 0; i < 5; i++) 
+    {
+        found[i] = DynamicArray<double>(n);
+        for (int v = 0; v < n; v++) found[i][v] = std::numeric_limits<double>::infinity();
+    }
+    MultiSourceBFS<int>::Run(csr, sources, 5, workspace, [&](int level, int vertex, uint64_t mask) 
+    {
+        for (int i = 0; i < 5; i++) 
+        {
+            if (mask & (uint64_t(1) << i)) found[i][vertex] = level;
+        }
+    });
+    for (int i = 0; i < 5; i++) 
+    {
+        for (int v = 0; v < n; v++) 
+        {
+            EXPECT_EQ(found[i][v], reference[sources[i]][v]);
+        }
+    }
+
+    GraphEccentricities<int> eccentricities = MultiSourceBFS<int>::ComputeEccentricities(csr, pool);
+    DynamicArray<double> closeness = MultiSourceBFS<int>::ClosenessCentrality(csr, pool);
+    for (int s = 0; s < n; s++) 
+    {
+        double eccentricity = 0.0;
+        double sum = 0.0;
+        int reached = 0;
+        for (int v = 0; v < n; v++) 
+        {
+            if (reference[s][v] == std::numeric_limits<double>::infinity()) continue;
+            eccentricity = std::max(eccentricity, reference[s][v]);
+            sum += reference[s][v];
+            reached++;
+        }
+        EXPECT_EQ(eccentricities.GetEccentricity(s), eccentricity);
+        double expected = sum == 0.0 ? 0.0 : (reached - 1.0) / (n - 1) * ((reached - 1.0) / sum);
+        EXPECT_NEAR(closeness[s], expected, 1e-12);
+    }
+    EXPECT_EQ(closeness[csr.IndexOf(VERTICES)], 0.0);
+
+    UndirectedGraph<int> path;
+    for (int v = 0; v < 100; v++) path.AddEdge(v, v + 1, 3.0);
+    EXPECT_EQ(MultiSourceBFS<int>::GetDiameter(CsrGraph<int>(path)), 100.0);
+    EXPECT_EQ(MultiSourceBFS<int>::GetRadius(CsrGraph<int>(path)), 50.0);
+    GraphEccentricities<int> pathEccentricities = MultiSourceBFS<int>::ComputeEccentricities(path);
+    ASSERT_EQ(pathEccentricities.GetCenter().GetSize(), 1);
+    EXPECT_EQ(pathEccentricities.GetCenter()[0], 50);
+    EXPECT_THROW(MultiSourceBFS<int>::Run(csr, sources, 0, workspace, [](int, int, uint64_t) {}), std::invalid_argument);
 }
 
-TEST(ShortestPathTest, GraphDiameterAndRadius) 
+TEST(ShortestPathTest, DISABLED_MultiSourceBFSBenchmark) 
 {
-    // Проверяет: Диаметр и радиус графа
+    // Проверяет: Время невзвешенных эксцентриситетов через MS-BFS против повторных BFSShortestPath
+    const int VERTICES = 20000;
     UndirectedGraph<int> graph;
-    
-    graph.AddEdge(1, 2);
-    graph.AddEdge(2, 3);
-    graph.AddEdge(3, 4);
-    graph.AddEdge(4, 5);
-    
-    double diameter = ShortestPath<int>::GetGraphDiameter(graph);
-    double radius = ShortestPath<int>::GetGraphRadius(graph);
-    
-    EXPECT_GT(diameter, 0.0);
-    EXPECT_GT(radius, 0.0);
-    EXPECT_GE(diameter, radius);
-    
-    auto center = ShortestPath<int>::FindGraphCenter(graph);
-    EXPECT_GT(center->GetLength(), 0);
-    delete center;
+    unsigned int seed = 47;
+    for (int v = 1; v < VERTICES; v++) 
+    {
+        for (int k = 0; k < 3; k++) 
+        {
+            graph.AddEdge(v, RandomBelow(seed, v), 1.0);
+        }
+    }
+    CsrGraph<int> csr(graph);
+
+    auto start = std::chrono::steady_clock::now();
+    GraphEccentricities<int> eccentricities = MultiSourceBFS<int>::ComputeEccentricities(csr);
+    auto msbfsTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    // Повторные BFS на части источников, время пересчитывается на все вершины
+    const int SAMPLE = 200;
+    int mismatches = 0;
+    start = std::chrono::steady_clock::now();
+    for (int s = 0; s < SAMPLE; s++) 
+    {
+        Dictionary<int, double>* dist = ShortestPath<int>::BFSShortestPath(csr, csr.GetVertex(s));
+        double eccentricity = 0.0;
+        dist->ForEach([&](const int&, const double& d) { eccentricity = std::max(eccentricity, d); });
+        if (eccentricity != eccentricities.GetEccentricity(s)) mismatches++;
+        delete dist;
+    }
+    auto sampleTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "[ BENCH    ] " << VERTICES << " vertices, diameter " << eccentricities.GetDiameter() << ": MS-BFS " << msbfsTime.count() << " ms, repeated BFS ~" << sampleTime.count() * (VERTICES / SAMPLE) << " ms" << std::endl;
+    EXPECT_EQ(mismatches, 0);
 }
 
 // 10. Тесты для PartialOrder
@@ -2251,6 +5298,47 @@ TEST(PartialOrderTest, InfimumAndSupremum)
     delete sup;
 }
 
+TEST(PartialOrderTest, ExtremalElementsAndBoundsFromInEdges) 
+{
+    // Проверяет: Минимальные/максимальные элементы и точные грани через входящие рёбра, петли не мешают
+    DirectedGraph<int> graph;
+    graph.AddEdge(1, 3);
+    graph.AddEdge(2, 3);
+    graph.AddEdge(3, 4);
+    graph.AddEdge(3, 5);
+
+    DirectedGraph<int> reflexive(graph);
+    reflexive.AddEdge(1, 1);
+    reflexive.AddEdge(5, 5);
+    EXPECT_TRUE(PartialOrder<int>::IsMinimalElement(reflexive, 1));
+    EXPECT_FALSE(PartialOrder<int>::IsMinimalElement(reflexive, 3));
+    EXPECT_TRUE(PartialOrder<int>::IsMaximalElement(reflexive, 5));
+    EXPECT_FALSE(PartialOrder<int>::IsMaximalElement(reflexive, 1));
+    auto reflexiveSources = TopologicalSort<int>::FindSources(reflexive);
+    EXPECT_EQ(reflexiveSources->GetLength(), 2);
+    delete reflexiveSources;
+
+    auto minimal = PartialOrder<int>::FindMinimalElements(graph);
+    ASSERT_EQ(minimal->GetLength(), 2);
+    EXPECT_EQ(minimal->Get(0), 1);
+    EXPECT_EQ(minimal->Get(1), 2);
+    delete minimal;
+
+    auto inf = PartialOrder<int>::FindInfimum(graph, 4, 5);
+    ASSERT_EQ(inf->GetLength(), 1);
+    EXPECT_EQ(inf->Get(0), 3);
+    delete inf;
+
+    auto sup = PartialOrder<int>::FindSupremum(graph, 1, 2);
+    ASSERT_EQ(sup->GetLength(), 1);
+    EXPECT_EQ(sup->Get(0), 3);
+    delete sup;
+
+    auto noInf = PartialOrder<int>::FindInfimum(graph, 1, 2);
+    EXPECT_EQ(noInf->GetLength(), 0);
+    delete noInf;
+}
+
 TEST(PartialOrderTest, LatticeCheck) 
 {
     // Проверяет: Проверку является ли порядок решеткой